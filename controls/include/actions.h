@@ -0,0 +1,202 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       actions.h                                                       */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Autonomous Action Scheduler Declarations                        */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef ACTIONS_HEADER_GUARD
+#define ACTIONS_HEADER_GUARD
+
+#include "vex.h"
+#include "odometry.h"
+
+using namespace vex;
+
+/**
+ * The parts of the robot an action uses. Two actions that use the same part
+ * never run at the same time: one that is ready to start waits for the other
+ * to finish.
+*/
+enum robotParts {
+    driveParts = 1,
+    intakeParts = 2,
+    liftParts = 4
+};
+
+/**
+ * Something autonomous does over several ticks, like a drive move (see
+ * driveMoves.h) or running the intake. Actions are run by an ActionPlan, one
+ * step per tick, so several can run at once.
+*/
+class Action {
+    public:
+        /** The robotParts this action uses (or'd together). */
+        const int parts;
+
+        Action(int parts) : parts(parts) {}
+
+        /** Called on the tick the action starts, before its first step(). */
+        virtual void begin() {}
+
+        /**
+         * Called once every tick while the action runs.
+         * @param const Pose &pose    Where the robot is.
+         * @returns bool              Whether the action is finished.
+        */
+        virtual bool step(const Pose &pose) = 0;
+
+        /** Called once when the action finishes, or when the plan is stopped before it does. */
+        virtual void end() {}
+};
+
+/** Runs the intake (see intakeMotors()) for a while. */
+class IntakeAction : public Action {
+    private:
+        int direction;
+        int ms;
+        uint32_t start = 0;
+
+    public:
+        /**
+         * @param int direction   One of intakeActions.
+         * @param int ms          How long to run it for. 0 runs it until the
+         *                            plan ends.
+        */
+        IntakeAction(int direction, int ms) : Action(intakeParts), direction(direction), ms(ms) {}
+        void begin();
+        bool step(const Pose &pose);
+        void end();
+};
+
+/** Runs the lift (see liftMotors()) for a while. */
+class LiftAction : public Action {
+    private:
+        int direction;
+        int ms;
+        uint32_t start = 0;
+
+    public:
+        /**
+         * @param int direction   One of liftActions.
+         * @param int ms          How long to run it for. 0 runs it until the
+         *                            plan ends.
+        */
+        LiftAction(int direction, int ms) : Action(liftParts), direction(direction), ms(ms) {}
+        void begin();
+        bool step(const Pose &pose);
+        void end();
+};
+
+/** When an action in an ActionPlan may start. Make them with the functions below. */
+struct StartCondition {
+    enum Kind { immediately, afterTime, afterDistance, afterAction } kind;
+    /** ms for afterTime, inches for afterDistance and an action for afterAction. */
+    double value;
+};
+
+/** Start as soon as the plan does. */
+inline StartCondition startNow() { return StartCondition{StartCondition::immediately, 0}; }
+/** Start once the plan has been running this long (ms). */
+inline StartCondition startAt(int ms) { return StartCondition{StartCondition::afterTime, (double)ms}; }
+/** Start once the robot has driven this far since the plan started (inches, forwards or backwards). */
+inline StartCondition startAfterDriving(double inches) { return StartCondition{StartCondition::afterDistance, inches}; }
+/** Start once another action in the plan (from ActionPlan::add()) has finished. */
+inline StartCondition startAfter(int action) { return StartCondition{StartCondition::afterAction, (double)action}; }
+
+/** The most actions one ActionPlan can hold. */
+const int MAX_PLAN_ACTIONS = 16;
+
+/**
+ * A set of actions that run together on one tick loop, each starting when
+ * its StartCondition is met. For example, to start the intake halfway
+ * through a drive and lift the ball once the robot has turned:
+ *
+ *      DriveDistance drive(24);
+ *      TurnToHeading turn(90);
+ *      IntakeAction intakeBall(intake, 1000);
+ *      LiftAction liftBall(up, 800);
+ *
+ *      ActionPlan plan;
+ *      int driving = plan.add(drive);
+ *      int turning = plan.add(turn, startAfter(driving));
+ *      plan.add(intakeBall, startAfterDriving(12));
+ *      plan.add(liftBall, startAfter(turning));
+ *      plan.run();
+ *
+ * Each tick, every running action steps, then actions whose conditions are
+ * now met start (in the order they were added) and take their first step,
+ * then the wheels are updated (see updateWheels()). So an action that starts
+ * after another one starts on the tick that one finishes. The plan does not own its actions, so they
+ * have to last until it has run.
+*/
+class ActionPlan {
+    private:
+        enum actionStates { waiting, running, finished };
+
+        Action *actions[MAX_PLAN_ACTIONS];
+        StartCondition conditions[MAX_PLAN_ACTIONS];
+        uint8_t states[MAX_PLAN_ACTIONS];
+        uint32_t startTimes[MAX_PLAN_ACTIONS];
+        uint32_t endTimes[MAX_PLAN_ACTIONS];
+        int count = 0;
+
+        /* When the plan started, and how far the robot has driven since. */
+        bool started = false;
+        uint32_t startTime = 0;
+        double travelled = 0;
+        double lastX = 0, lastY = 0;
+
+        /* The robotParts used by the running actions. */
+        int busyParts = 0;
+
+        bool ready(int action, uint32_t now);
+        void stepAction(int action, const Pose &pose);
+
+    public:
+        /**
+         * Adds an action to the plan.
+         * @param Action &action          The action.
+         * @param StartCondition when     When it may start.
+         * @returns int                   The action's number in the plan (for
+         *                                    startAfter()), or -1 if the
+         *                                    plan is full.
+        */
+        int add(Action &action, StartCondition when = startNow());
+
+        /**
+         * Runs one tick of the plan, without waiting. For running the plan
+         * from a loop of your own, instead of run().
+         * @returns bool    Whether every action has finished.
+        */
+        bool step();
+
+        /**
+         * Runs the plan, one step every TICK_LENGTH, until every action has
+         * finished or the timeout. Actions still running at the timeout are
+         * ended.
+         * @param int timeout     The longest the plan may take (ms).
+         * @returns bool          Whether every action finished.
+        */
+        bool run(int timeout = 15000);
+
+        /** Ends every running action, and stops the plan. */
+        void stop();
+
+        /** @returns bool    Whether an action has finished. */
+        bool isFinished(int action) const { return states[action] == finished; }
+
+        /** @returns uint32_t    When an action started and finished, in ms since the plan started (for timing runs). */
+        uint32_t getStartTime(int action) const { return startTimes[action]; }
+        uint32_t getEndTime(int action) const { return endTimes[action]; }
+};
+
+/**
+ * Runs a single action until it is finished (for the blocking moves in
+ * driveMoves.h), however long that takes.
+*/
+void runAction(Action &action);
+
+#endif
@@ -0,0 +1,141 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       actuatorCommands.h                                              */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Intake And Lift Command Queue Declarations                      */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef ACTUATOR_COMMANDS_HEADER_GUARD
+#define ACTUATOR_COMMANDS_HEADER_GUARD
+
+#include "vex.h"
+#include <atomic>
+
+using namespace vex;
+
+/**
+ * What the driver wants the intake and lift to do, one per function button.
+ *
+ * Where two are held at once, the one further down the list wins (like the
+ * speed buttons, where slow wins): bringing a ball down or expelling it gets
+ * it out of a jam, so it beats lifting or intaking.
+*/
+enum actuatorIntents {
+    liftUpIntent = 0,
+    liftDownIntent = 1,
+    intakeIntent = 2,
+    expelIntent = 3,
+    NUM_ACTUATOR_INTENTS
+};
+
+/**
+ * One button event, posted by the SDK's event threads and applied by the
+ * control loop.
+*/
+struct ActuatorCommand {
+    /** From `actuatorIntents`. */
+    uint8_t intent;
+
+    /** Whether the button was pressed (true) or let go (false). */
+    bool pressing;
+
+    /** When it was posted (timer::systemHighResolution(), µs, wraps after ~71 minutes). */
+    uint32_t time;
+};
+
+/**
+ * A fixed size queue of commands that any number of producers (the button
+ * event threads) can post to at the same time, with exactly one consumer (the
+ * control loop). Nobody ever waits for a lock.
+ *
+ * Every slot has a sequence number saying whose turn it is. A producer claims
+ * the slot at `head` by moving `head` on with a compare and swap (only one
+ * producer can win it), writes the command, then publishes it by setting the
+ * slot's sequence to one past its position. The consumer takes the slot at
+ * `tail` once its sequence says it was published, then hands it back to the
+ * producers by setting its sequence to its position in the next lap. A
+ * producer that claimed a slot but has not finished writing it only holds up
+ * the consumer at that slot, never another producer.
+ *
+ * Like TelemetryBuffer, the counters only ever go up and CAPACITY is a power
+ * of two. If the queue is full, then the new command is dropped and counted.
+*/
+class CommandQueue {
+    public:
+        /** At most 8 buttons change each tick (press and release), so 16 leaves plenty of room. */
+        static const uint32_t CAPACITY = 16;
+
+    private:
+        static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+
+        struct Slot {
+            std::atomic<uint32_t> sequence;
+            ActuatorCommand command;
+        };
+
+        Slot slots[CAPACITY];
+
+        /* The number of slots claimed by producers, and taken by the consumer. */
+        std::atomic<uint32_t> head;
+        std::atomic<uint32_t> tail;
+
+        std::atomic<uint32_t> dropped;
+
+    public:
+        CommandQueue();
+
+        /**
+         * Adds a command to the queue (any producer). Never waits.
+         * @returns bool    Whether there was room for the command (if not, it
+         *                      was dropped and counted).
+        */
+        bool push(const ActuatorCommand &command);
+
+        /**
+         * Takes the oldest published command off the queue (consumer only).
+         * @param ActuatorCommand &command  Where to copy the command.
+         * @returns bool                    Whether there was one.
+        */
+        bool pop(ActuatorCommand &command);
+
+        /** @returns uint32_t   The number of commands waiting (including ones still being written). */
+        uint32_t size() { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+
+        /** @returns uint32_t   The number of commands dropped because the queue was full. */
+        uint32_t getDropped() { return dropped.load(std::memory_order_relaxed); }
+};
+
+/** The queue between the function buttons and the control loop. */
+extern CommandQueue actuatorQueue;
+
+/**
+ * Posts a button event to actuatorQueue. Safe to call from any task.
+ * @param int intent        From `actuatorIntents`.
+ * @param bool pressing     Whether the button was pressed or let go.
+*/
+void postActuatorCommand(int intent, bool pressing);
+
+/**
+ * Has the function buttons (functionUp, functionDown, functionIntake and
+ * functionExpel) post their presses and releases to actuatorQueue. Call once,
+ * at the start of driver control.
+*/
+void registerActuatorButtons();
+
+/**
+ * Applies every command waiting in actuatorQueue, then sets the lift and
+ * intake from the buttons held (see `actuatorIntents` for which wins), as
+ * changed by the indexer to move the balls along (see indexBalls()). This
+ * is the only place the lift and intake are commanded in driver control, so
+ * the motors always match the buttons held, however the events interleaved.
+ * Records the queue's depth and how long each command waited (see latency.h).
+ * Called once per tick by the control loop.
+*/
+void applyActuatorCommands();
+
+/** @returns uint32_t   One bit per `actuatorIntents`, set while its button is held. */
+uint32_t getHeldIntents();
+
+#endif
@@ -0,0 +1,71 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       battery.h                                                       */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Battery Voltage Compensation Declarations                       */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef BATTERY_HEADER_GUARD
+#define BATTERY_HEADER_GUARD
+
+#include "vex.h"
+
+using namespace vex;
+
+/**
+ * The battery voltage at which a motor given a command of x volts really gets
+ * x volts. A command is a fraction of this, taken from whatever the battery
+ * has, so a full battery (about 12.8 V) gives a little more than was asked
+ * for and a tired one sagging under load (11 V or less) a lot less. The wheel
+ * gains (see WHEEL_GAINS) are worked out for this voltage.
+*/
+const double NOMINAL_BATTERY_VOLTAGE = 12.0;
+
+/**
+ * Readings below this (volts) are ignored, so that a bad reading (like 0
+ * before the brain has read the battery) can not make the drive think it
+ * needs to give the motors several times what it asks for.
+*/
+const double MIN_BATTERY_READING = 6.0;
+
+/**
+ * How much of the way each reading moves the battery voltage towards it. The
+ * battery is read every WHEEL_CONTROL_PERIOD, so this follows sag within a
+ * few tens of milliseconds while smoothing out single noisy readings.
+*/
+const double BATTERY_SMOOTHING = 0.25;
+
+/**
+ * Whether the drive's voltages are compensated for the battery (see
+ * batteryScale()). Only turned off to compare (like the simulator's battery
+ * benchmark).
+*/
+extern bool batteryCompensation;
+
+/**
+ * Reads the battery voltage. Called by the wheel control task before it runs
+ * the wheels' velocity controllers, every WHEEL_CONTROL_PERIOD, so the
+ * voltages they work out are always scaled with a fresh reading.
+*/
+void updateBattery();
+
+/** @returns double   The battery voltage (volts, smoothed). */
+double batteryVoltage();
+
+/** @returns double   The lowest batteryVoltage() so far (volts), the worst sag under load. */
+double lowestBatteryVoltage();
+
+/**
+ * The velocity controllers work out the voltage the motors should really get
+ * (see VelocityController). Multiplying by this turns that into the command
+ * that gets them it from the battery as it is right now, so the same stick
+ * gives the same speed (and the feedforward stays right) from the first
+ * match to the last.
+ * @returns double    NOMINAL_BATTERY_VOLTAGE / batteryVoltage(), or 1 if
+ *                        batteryCompensation is off.
+*/
+double batteryScale();
+
+#endif
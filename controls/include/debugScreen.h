@@ -11,57 +11,219 @@
 #define DEBUG_HEADER_GUARD
 
 #include "vex.h"
+#include "telemetry.h"
 
 using namespace vex;
 
 /** The temperature units used to report the temperature on the debug screen */
 extern temperatureUnits u;
 
+/**
+ * How often the debug screen is redrawn, in milliseconds.
+*/
+const int DEBUG_REFRESH_TIME = 100;
+
+/**
+ * The pages the debug screen can show. The `showLatency` button goes to the
+ * next one (and from the last one back to the first).
+*/
+enum debugPages {
+    mainPage = 0,
+    latencyPage = 1,
+    posePage = 2,
+    safetyPage = 3,
+    indexerPage = 4,
+    NUM_DEBUG_PAGES
+};
+
+/**
+ * Everything shown on the debug screen, as it was at the end of one control
+ * tick.
+ *
+ * The screen is slow to draw, so it is drawn by its own low priority task
+ * (see startDebugScreen()) instead of the control loop. The control loop only
+ * copies the values it wants shown into a snapshot once per tick with
+ * publishDebugSnapshot(), which is quick. Drawing the screen can then never
+ * make the robot respond to the controller later.
+*/
+struct DebugSnapshot {
+    /** The page that should be shown (from `debugPages`). */
+    int page;
+
+    /** The controller state the tick used. */
+    InputFrame input;
+
+    /** The velocity of each wheel train, in the same order as wheelTrains. */
+    int wheelVelocities[NUM_WHEEL_TRAINS];
+
+    /**
+     * Each motor's temperature (in `u`) and how long until it is throttled
+     * (seconds, see ThermalTracker::secondsToThrottle()), in the same order as
+     * allMotors.
+    */
+    double temperatures[NUM_MOTORS], secondsToThrottle[NUM_MOTORS];
+
+    /** The power the drive is allowed (see drivePower()). */
+    double drivePower;
+
+    /** See Ticker (ticker.h). Times are in microseconds. */
+    uint32_t tickPeriod, tickOverruns, tickWorstJitter;
+
+    /** Motor commands sent and skipped by every CachedMotor (motorCache.h). */
+    uint32_t motorCommandsSent, motorCommandsSuppressed;
+
+    /** See telemetry.h. */
+    TelemetryStats telemetry;
+};
+
+/**
+ * Copies the tick's controller state and the current state of the wheels,
+ * motors and control ticker into the snapshot that the debug screen task
+ * draws. Called once per tick by the control loop.
+ * @param InputFrame &input   The controller state used this tick.
+*/
+void publishDebugSnapshot(const InputFrame &input);
+
+/**
+ * Copies the most recently published snapshot.
+ *
+ * Snapshots are double buffered: publishDebugSnapshot() always writes the
+ * buffer that is not the newest one, then flips which one is newest. If a
+ * copy overlaps with a publish that reuses the buffer being copied, then the
+ * copy is simply done again.
+ *
+ * @param DebugSnapshot &snapshot     Where to copy the snapshot.
+*/
+void readDebugSnapshot(DebugSnapshot &snapshot);
+
+/**
+ * Starts the low priority task that redraws the debug screen every
+ * DEBUG_REFRESH_TIME milliseconds from the latest snapshot.
+*/
+void startDebugScreen();
+
+/**
+ * The number of rows of text that fit on the brain's screen, and the number of
+ * characters that fit on each row (with the default font).
+*/
+const int DEBUG_ROWS = 13;
+const int DEBUG_COLUMNS = 48;
+
+/**
+ * Draws one row of the debug screen, formatted like printf().
+ *
+ * The text last drawn on each row is remembered, and a row is only drawn again
+ * if its text changed. A changed row is drawn with one print over the old
+ * text (padded with spaces if it got shorter) instead of clearing the screen
+ * first, so the screen does not flicker and a frame where only a stick moved
+ * costs a couple of screen calls instead of a whole redraw.
+ *
+ * @param int row   The row to draw (starting at 0 at the top).
+*/
+void drawRow(int row, const char *format, ...);
+
 /**
  * Displays the current value of the axes of the left analog stick.
 */
-void leftAnalogStick();
+void leftAnalogStick(const DebugSnapshot &snapshot);
 
 /**
  * Displays the current value of the axes of the right analog stick.
 */
-void rightAnalogStick();
+void rightAnalogStick(const DebugSnapshot &snapshot);
 
 /**
  * Displays whether or not the A/B/X/Y buttons are being pressed.
 */
-void buttons();
+void buttons(const DebugSnapshot &snapshot);
 
 /**
  * Displays whether or not each arrow button is being pressed.
 */
-void arrows();
+void arrows(const DebugSnapshot &snapshot);
 
 /**
  * Displays whether or not each bumper is being pressed (the back/top buttons).
 */
-void bumpers();
+void bumpers(const DebugSnapshot &snapshot);
+
+/**
+ * Displays the velocity of each wheel train (in rpm).
+*/
+void print_rpm(const DebugSnapshot &snapshot);
+
+/**
+ * Displays how many ticks have been recorded for the SD card (see
+ * telemetry.h), and how many were dropped because the SD card fell behind or
+ * failed.
+*/
+void telemetryStats(const DebugSnapshot &snapshot);
+
+/**
+ * Displays how many motor commands have been sent, and how many were not sent
+ * because they would not have changed anything.
+*/
+void motorCommands(const DebugSnapshot &snapshot);
 
 /**
- * Displays the temperature of all motors like so:
+ * Displays the temperature of all motors, how long until each is throttled by
+ * its firmware at the rate it is heating up ("--" if it is not, "HOT" if it
+ * already is), and how much power the drive has been left with (see
+ * thermal.h) like so:
  *
- * Motor Temperature:
- * ne : 20 | nw : 20 | se : 20 | sw : 20
- * liftleft : 20 | liftright : 20 | intakeleft : 20 | intakeright : 20
+ * Motor Temp (celcius) | drive power | 100%
+ * rw | 41.2 (3:20) | lw | 40.8 (4:05)
+ * intake | 30.0 (--) | 30.0 (--)
+ * lift | 25.0 (--) | 25.0 (--)
+*/
+void temperature(const DebugSnapshot &snapshot);
+
+/**
+ * Displays how long the last control tick took, how many tick deadlines have
+ * been missed, and the latest a tick has started (see ticker.h).
+*/
+void tickStats(const DebugSnapshot &snapshot);
+
+/**
+ * Displays the latency report (see latency.h), and whether it was saved to the
+ * SD card when the page was opened.
+*/
+void latencyStats(bool saved);
+
+/**
+ * Displays where odometry thinks the robot is (see odometry.h). Read straight
+ * from the odometry task's pose, not the snapshot.
+*/
+void poseStats();
+
+/**
+ * Displays the emergency stop (see emergencyStop.h), the stalls the watchdog
+ * caught (see watchdog.h), the commands actuatorQueue dropped, the battery
+ * (see battery.h) and how many times each wheel train has slipped (see
+ * traction.h).
+*/
+void safetyStats();
+
+/**
+ * Displays how many balls are held and where (see indexer.h), how many have
+ * been collected and scored, how many are scored per second while cycling and
+ * how long a ball is held at each stage on average.
 */
-void temperature();
+void indexerStats();
 
 /**
  * Wipes the debug info from the brain's screen and places the cursor at the
- * origin.
+ * origin. Every row is drawn again on the next frame.
 */
 void resetDebug();
 
 /**
  * Main function for displaying all the debug information on the screen.
- * Calls the above functions.
+ * Calls the above functions, which only draw the rows that changed since the
+ * last frame. Yields between them so that other tasks (the control loop)
+ * never have to wait for the whole screen to be drawn.
 */
-void debugMenuController();
+void debugMenuController(const DebugSnapshot &snapshot);
 
 void number(double numb);
 
@@ -0,0 +1,211 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       driveMoves.h                                                    */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Autonomous Drive Move Declarations                              */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef DRIVE_MOVES_HEADER_GUARD
+#define DRIVE_MOVES_HEADER_GUARD
+
+#include "vex.h"
+#include "side.h"
+#include "odometry.h"
+#include "actions.h"
+#include <cmath>
+
+using namespace vex;
+
+/**
+ * Turns are multiplied by this, so that a route written for the right side
+ * is mirrored on the left side (SIDE is -1). SIDE is 0 when there is no
+ * autonomous (like when testing in the simulator), which drives like the right
+ * side.
+*/
+const int MIRROR = SIDE < 0 ? -1 : 1;
+
+/**
+ * When a move is finished.
+ *
+ * A move is finished once it has been within `tolerance` of where it is going
+ * for `settleTime` milliseconds in a row, or after `timeout` milliseconds no
+ * matter what (so a robot stuck on a goal does not lose the rest of
+ * autonomous).
+*/
+struct ExitConditions {
+    /** How close is close enough (inches for driveDistance(), degrees for turns). */
+    double tolerance;
+    /** How long it has to stay that close (ms). */
+    int settleTime;
+    /** The longest the move may take (ms). */
+    int timeout;
+};
+
+const ExitConditions DRIVE_EXIT = {0.5, 100, 5000};
+const ExitConditions TURN_EXIT = {1.0, 100, 3000};
+const ExitConditions ARC_EXIT = {1.0, 100, 6000};
+const ExitConditions PATH_EXIT = {1.0, 100, 15000};
+
+/** The default top speed of a move (rpm). */
+const int MOVE_SPEED = 50;
+
+/**
+ * How much of AUTONOMOUS_LIMITS.maxAcceleration a move plans to slow down
+ * with. Less than all of it, because the wheels also take time to respond.
+*/
+constexpr double MOVE_BRAKING = 0.7;
+
+/**
+ * Close to the end, a move slows down in proportion to how far it has left,
+ * as if it would get there in this many seconds. Braking as late as possible
+ * all the way in would arrive too fast, because the wheels take a moment to
+ * respond (see MotionProfile), and the robot would rock back and forth past
+ * where it should stop.
+*/
+const double MOVE_APPROACH_TIME = 0.3;
+
+/** Inches per second the robot moves for each rpm of the wheels. */
+constexpr double INCHES_PER_SECOND_PER_RPM = WHEEL_DIAMETER * M_PI * DRIVE_GEAR_RATIO / 60.0;
+
+/** How hard driveDistance() steers back to its heading (rpm per degree off). */
+const double HEADING_CORRECTION = 1.0;
+
+/**
+ * The fastest a wheel can go and still stop within a distance, slowing down
+ * at MOVE_BRAKING of the autonomous acceleration, and slowing down evenly
+ * over the last MOVE_APPROACH_TIME.
+ * @param double distance     How far there is left to go (inches).
+ * @param int speed           The fastest it may go anyway (rpm).
+ * @returns double            The velocity (rpm), signed like `distance`.
+*/
+double approachSpeed(double distance, int speed);
+
+/**
+ * A drive move, as an action (see actions.h) so it can run alongside the
+ * intake and lift. Each tick it sets the wheels' goal velocities, and it
+ * finishes once its ExitConditions are met. It stops the wheels at the end.
+*/
+class DriveMove : public Action {
+    private:
+        uint32_t start = 0;
+        uint32_t insideSince = 0;
+        bool inside = false;
+        bool reached = false;
+
+    protected:
+        ExitConditions exit;
+
+        /**
+         * Called when the move starts, to work out where it is going from
+         * where the robot is then.
+        */
+        virtual void startMove(const Pose &) {}
+
+        /**
+         * Sets the wheels' goal velocities for one tick (see setDriveGoals()).
+         * @returns double    How far the move still has to go (in the units of
+         *                        exit.tolerance).
+        */
+        virtual double drive(const Pose &pose) = 0;
+
+        /** Sets the goal velocities of both sides of the drive (rpm). */
+        static void setDriveGoals(double left, double right);
+
+    public:
+        DriveMove(ExitConditions exit) : Action(driveParts), exit(exit) {}
+        void begin();
+        bool step(const Pose &pose);
+        void end();
+
+        /** @returns bool    Whether the move got there (false if it timed out). */
+        bool succeeded() const { return reached; }
+};
+
+/** The action behind driveDistance(). */
+class DriveDistance : public DriveMove {
+    private:
+        double inches;
+        int speed;
+        Pose start;
+
+    protected:
+        void startMove(const Pose &pose);
+        double drive(const Pose &pose);
+
+    public:
+        DriveDistance(double inches, int speed = MOVE_SPEED, ExitConditions exit = DRIVE_EXIT)
+            : DriveMove(exit), inches(inches), speed(speed) {}
+};
+
+/** The action behind turnToHeading(). */
+class TurnToHeading : public DriveMove {
+    private:
+        double target;
+        int speed;
+
+    protected:
+        double drive(const Pose &pose);
+
+    public:
+        TurnToHeading(double heading, int speed = MOVE_SPEED, ExitConditions exit = TURN_EXIT)
+            : DriveMove(exit), target(heading * MIRROR), speed(speed) {}
+};
+
+/** The action behind driveArc(). */
+class DriveArc : public DriveMove {
+    private:
+        double radius, degrees;
+        int speed;
+        double target = 0;
+
+    protected:
+        void startMove(const Pose &pose);
+        double drive(const Pose &pose);
+
+    public:
+        DriveArc(double radius, double degrees, int speed = MOVE_SPEED, ExitConditions exit = ARC_EXIT)
+            : DriveMove(exit), radius(radius), degrees(degrees), speed(speed) {}
+};
+
+/*
+ * The moves below run one of the actions above on its own, blocking until it
+ * is finished, and return true if it got there (false if it timed out). They
+ * use odometry (see odometry.h) instead of timing, so they end up in the
+ * same place whatever the battery, the carpet or the robot's weight.
+*/
+
+/**
+ * Drives straight for a distance, holding the heading it started with.
+ * @param double inches           How far (negative is backwards).
+ * @param int speed               The top speed (rpm).
+ * @param ExitConditions exit     When the move is finished.
+ * @returns bool                  Whether it got there before the timeout.
+*/
+bool driveDistance(double inches, int speed = MOVE_SPEED, ExitConditions exit = DRIVE_EXIT);
+
+/**
+ * Turns on the spot to face a heading (the short way round).
+ * @param double heading          Degrees clockwise from where autonomous
+ *                                    started, mirrored on the left side.
+ * @param int speed               The top speed of the wheels (rpm).
+ * @param ExitConditions exit     When the move is finished.
+ * @returns bool                  Whether it got there before the timeout.
+*/
+bool turnToHeading(double heading, int speed = MOVE_SPEED, ExitConditions exit = TURN_EXIT);
+
+/**
+ * Drives forward along part of a circle.
+ * @param double radius           From the center of the circle to the middle
+ *                                    of the robot (inches).
+ * @param double degrees          How far around the circle. Positive curves
+ *                                    right, mirrored on the left side.
+ * @param int speed               The top speed of the outside wheels (rpm).
+ * @param ExitConditions exit     When the move is finished (tolerance in
+ *                                    degrees).
+ * @returns bool                  Whether it got there before the timeout.
+*/
+bool driveArc(double radius, double degrees, int speed = MOVE_SPEED, ExitConditions exit = ARC_EXIT);
+
+#endif
@@ -0,0 +1,55 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       emergencyStop.h                                                 */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Emergency Stop Watchdog Declarations                            */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef EMERGENCY_STOP_HEADER_GUARD
+#define EMERGENCY_STOP_HEADER_GUARD
+
+#include "vex.h"
+
+using namespace vex;
+
+/**
+ * How often (in milliseconds) the emergency stop task checks the stopMotors
+ * button. Ten times as often as the control tick, so a press is never missed
+ * for a whole tick.
+*/
+const int EMERGENCY_STOP_PERIOD = 5;
+
+/**
+ * The longest it may take (in milliseconds) from pressing stopMotors to every
+ * motor being told to stop.
+ *
+ * The button is checked every EMERGENCY_STOP_PERIOD, by a task with the
+ * highest priority, so the task can only be held up by the other high
+ * priority tasks (wheel control and odometry), which each run for well under
+ * a millisecond. Stopping the motors takes a few more microseconds. Presses
+ * that took longer than this are counted (see getEmergencyStopsLate()).
+*/
+const int EMERGENCY_STOP_LIMIT = 7;
+
+/**
+ * Starts the high priority task that stops every motor (see emergencyStop())
+ * as soon as stopMotors is pressed, and keeps them stopped until it is let
+ * go. When it is let go, the wheels start again from rest, so the robot picks
+ * up speed gradually like it does when it first moves.
+ *
+ * How long each stop took is recorded in stopLatencyHistogram (see
+ * latency.h). It is measured from the last time the button was seen let go,
+ * since the press could have been any time after that, so it is never less
+ * than the real latency.
+*/
+void startEmergencyStop();
+
+/** @returns bool   Whether the motors are stopped because stopMotors is held. */
+bool isEmergencyStopped();
+
+/** @returns uint32_t   The number of stops that took longer than EMERGENCY_STOP_LIMIT. */
+uint32_t getEmergencyStopsLate();
+
+#endif
@@ -42,26 +42,62 @@ const int MAX_SPEED = 100;
 */
 const int MAX_AXIS_VALUE = 127;
 
+/*
+ * Sets the wheels' goal velocities from forward and turning velocities,
+ * without moving them yet (see updateWheels()).
+ * @param forward      How fast to go forward (rpm).
+ * @param turnvalue    How fast to turn (rpm), positive is right.
+*/
+void setWheelGoals(int forward, int turnvalue);
+
+/*
+ * Moves every wheel one tick closer to its goal velocity. Wheels with less
+ * far to go keep in proportion with the one with the furthest to go, so they
+ * all get there together and the robot keeps going in the direction it is
+ * meant to. Call once per tick.
+*/
+void updateWheels();
+
 /*
  * Moves the robot based on forward and turnvalue analog stick displacement
+ * (setWheelGoals() then updateWheels(), so call it once per tick).
  * @param foward       Value of the y axis of the movement analog stick. 
  * @param turnvalue    Value of the turn analog stick horizontally.
 */
 void movement(int forward, int turnvalue);
 
+/*
+ * Moves the robot based on the movement and turning analog sticks in the
+ * tick's input, through the stick curves of the driver profile and speed
+ * mode in use (see stickCurves.h).
+ * @param input        The controller state for this tick.
+*/
+void movement(const InputFrame &input);
+
 void liftMotors(int dir);
 
 void intakeMotors(int dir);
 
 
 /*
- * Immediately stops all motor movement and brakes (using brakeType brake).
+ * Immediately stops all motor movement and brakes (using brakeType brake),
+ * through allMotors, and halts every CachedMotor so nothing can start them
+ * again until resumeMotors() (see emergencyStop.h and watchdog.h).
+ * @param uint32_t reason     Why (from `haltReasons` in motorCache.h).
  *
  * An extremely rare phenomenon is that the motors don't stop moving, refuze
  * to change direction, or otherwise become unresponsive. If this were to
  * happen during a match, this could cause problems. If the robot starts to run
  * away, then hit this button to immediately stop it from moving. 
 */
-void emergencyStop();
+void emergencyStop(uint32_t reason = emergencyStopHalt);
+
+/*
+ * Takes back an emergencyStop() for one reason. Once nothing is holding the
+ * motors halted, the wheels start again from rest, instead of jumping back to
+ * the velocity they were headed for.
+ * @param uint32_t reason     The reason given to emergencyStop().
+*/
+void resumeMotors(uint32_t reason);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,131 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       indexer.h                                                       */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Ball Indexing Declarations                                      */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef INDEXER_HEADER_GUARD
+#define INDEXER_HEADER_GUARD
+
+#include "vex.h"
+
+using namespace vex;
+
+/**
+ * The most balls the robot holds on to, packed one behind the other down from
+ * the top of the lift (see indexBalls()). Once the first one is at the top,
+ * the lift can not bring any more up without scoring it.
+*/
+const int MAX_BALLS = 3;
+
+/**
+ * The most balls that fit in the robot at all, packed all the way from the
+ * mouth to the top while balls are being scored and taken in at the same
+ * time. This many are kept track of.
+*/
+const int MAX_TRACKED_BALLS = 5;
+
+/** How big a ball is (inches). */
+const double BALL_DIAMETER = 6.3;
+
+/** How far (inches) a ball is carried for each turn of the intake and lift motors. */
+const double INTAKE_INCHES_PER_TURN = 8.6;
+const double LIFT_INCHES_PER_TURN = 8.6;
+
+/**
+ * Where along the balls' path through the robot (inches on from the mouth
+ * sensor) the lift takes a ball over from the intake rollers, and where the
+ * top sensor sees it.
+*/
+const double LIFT_ENTRY = 8;
+const double TOP_POSITION = 24;
+
+/**
+ * How far (inches) either side of a sensor a ball can be and still be seen.
+ * Less than half a ball, so the sensor sees a gap between two balls touching.
+*/
+const double SENSOR_REACH = 2.4;
+
+/**
+ * How close (inches) a ball in the intake is taken up to the ball ahead of
+ * it. Any closer and the rollers only rub on it.
+*/
+const double PACKED_MARGIN = 0.5;
+
+/**
+ * Balls scored less than this long apart (ms) count as one run of cycling, for
+ * the balls per second (see IndexerStats).
+*/
+const uint32_t CYCLE_GAP = 2000;
+
+/**
+ * Whether the indexer moves the balls along on its own (see indexBalls()).
+ * Balls are still tracked without it. Also does nothing when either sensor is
+ * not plugged in, which leaves the intake and lift to the driver like before.
+*/
+extern bool ballIndexing;
+
+/** Where a ball is in the robot. */
+enum ballStages {
+    mouthStage = 0, //In front of the mouth sensor, being taken in
+    liftStage = 1,  //Past the mouth, on its way up (or waiting at the bottom of the lift)
+    topStage = 2,   //In front of the top sensor, ready to score
+    NUM_BALL_STAGES
+};
+
+/** What the indexer knows about the balls, as of the last indexBalls(). */
+struct IndexerStats {
+    /** How many balls are held, and where, the one nearest the top first. */
+    int balls;
+    int stages[MAX_TRACKED_BALLS];
+    /** Inches on from the mouth sensor (worked out from how far the rollers turned). */
+    double positions[MAX_TRACKED_BALLS];
+
+    /** Balls taken in, scored out of the top and put back out of the mouth. */
+    uint32_t collected, scored, expelled;
+
+    /** Balls scored per second while cycling (scored within CYCLE_GAP of each other). */
+    double ballsPerSecond;
+
+    /** How long a ball was held at each stage on average (ms, from `ballStages`). */
+    double stageTimes[NUM_BALL_STAGES];
+};
+
+/**
+ * Keeps track of how many balls are held and where, and, with ballIndexing,
+ * moves them along to the next place they can wait:
+ *  - A ball seen at the mouth is taken in by the intake, up to the ball ahead
+ *        of it (or into the lift).
+ *  - Once it is in as far as it can go, the lift brings the balls up until
+ *        the one nearest the top is MAX_BALLS - balls held ball lengths below
+ *        the top, so each new ball packs in right behind the others. With
+ *        MAX_BALLS held, the first one is at the top, ready to score, and the
+ *        rest follow it out one straight after another.
+ *  - The intake only collects (the intake button) while there is room.
+ * The lift button scores, and the intake keeps feeding the lift meanwhile.
+ * Bringing balls down and expelling are left to the driver, to get out of a
+ * jam: while the lift is held down, the intake only does what the driver
+ * asks.
+ *
+ * A ball is counted when it is seen at the mouth, and followed by how far the
+ * intake and lift turned since, put right whenever it goes past a sensor.
+ *
+ * Called once per tick by the control loop (applyActuatorCommands()), between
+ * working out what the driver wants and setting the motors.
+ * @param int &lift       What the driver wants the lift to do (from
+ *                            `liftActions`), changed to what it should do.
+ * @param int &intaking   What the driver wants the intake to do (from
+ *                            `intakeActions`), changed to what it should do.
+*/
+void indexBalls(int &lift, int &intaking);
+
+/** @returns IndexerStats   A copy of what the indexer knows (for the debug screen). */
+IndexerStats getIndexerStats();
+
+/** Forgets every ball and the stats (the simulator's benchmark). */
+void resetIndexer();
+
+#endif
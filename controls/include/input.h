@@ -0,0 +1,77 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       input.h                                                         */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Per Tick Controller Input Declarations                          */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef INPUT_HEADER_GUARD
+#define INPUT_HEADER_GUARD
+
+using namespace vex;
+
+/**
+ * The axes of the controller, in the order they are stored in an InputFrame.
+*/
+enum InputAxis {
+    Axis1 = 0,
+    Axis2,
+    Axis3,
+    Axis4,
+    NUM_AXES
+};
+
+/**
+ * The buttons of the controller. Each one is one bit of InputFrame#buttons.
+*/
+enum InputButton {
+    ButtonL1 = 0,
+    ButtonL2,
+    ButtonR1,
+    ButtonR2,
+    ButtonUp,
+    ButtonDown,
+    ButtonLeft,
+    ButtonRight,
+    ButtonX,
+    ButtonB,
+    ButtonY,
+    ButtonA,
+    NUM_BUTTONS
+};
+
+/**
+ * The state of every axis and button of the controller at one moment.
+ *
+ * Every tick the controller is read exactly once (see sampleInput()), and the
+ * resulting frame is handed to everything that needs to know about the
+ * controller that tick (movement, speed modes, debug screen). That way every
+ * part of the tick sees the same controller state, and the number of reads
+ * from the controller each tick is always NUM_AXES + NUM_BUTTONS.
+*/
+struct InputFrame {
+    /** When the controller was read (timer::systemHighResolution(), µs). */
+    uint64_t time;
+
+    /** The value of each axis (-127 to 127), indexed by InputAxis. */
+    int32_t axes[NUM_AXES];
+
+    /** One bit per InputButton, set if the button was being pressed. */
+    uint32_t buttons;
+
+    /** @returns int32_t    The value of the axis. */
+    int32_t axis(InputAxis axis) const { return axes[axis]; }
+
+    /** @returns bool   Whether the button was being pressed. */
+    bool pressing(InputButton button) const { return (buttons >> button) & 1; }
+};
+
+/**
+ * Reads every axis and button of the main controller into a frame.
+ * @param InputFrame &frame     The frame to fill.
+*/
+void sampleInput(InputFrame &frame);
+
+#endif
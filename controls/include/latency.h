@@ -0,0 +1,149 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       latency.h                                                       */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Control Loop Latency Instrumentation Declarations               */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef LATENCY_HEADER_GUARD
+#define LATENCY_HEADER_GUARD
+
+#include "vex.h"
+
+using namespace vex;
+
+/**
+ * Counts how often values (times in microseconds) fall into fixed buckets, so
+ * that percentiles can be reported without storing every value or using the
+ * heap.
+ *
+ * Values below 16 get their own bucket. Above that, every power of two is
+ * split into 16 buckets. A percentile is reported as the middle of its
+ * bucket, so it is at most 1/32nd (about 3%) off the real one either way.
+ * The minimum and maximum are kept exactly.
+*/
+class Histogram {
+    public:
+        static const int SUB_BUCKET_BITS = 4;
+        static const int SUB_BUCKETS = 1 << SUB_BUCKET_BITS;
+        static const int NUM_BUCKETS = SUB_BUCKETS + (32 - SUB_BUCKET_BITS) * SUB_BUCKETS;
+
+    private:
+        uint32_t counts[NUM_BUCKETS];
+        uint32_t total;
+        uint32_t smallest;
+        uint32_t largest;
+        uint64_t sum;
+
+        static int bucketOf(uint32_t value);
+        static uint32_t bucketMiddle(int bucket);
+
+    public:
+        Histogram() { clear(); }
+
+        void clear();
+        void record(uint32_t value);
+
+        /** @returns uint32_t   The number of values recorded. */
+        uint32_t count() const { return total; }
+
+        /** @returns uint32_t   The largest value recorded. */
+        uint32_t max() const { return largest; }
+
+        /** @returns uint32_t   The average of the values recorded. */
+        uint32_t mean() const { return total ? (uint32_t)(sum / total) : 0; }
+
+        /**
+         * @param int percent     The percentile to find (50 for the median).
+         * @returns uint32_t      About the value that `percent` percent
+         *                            of the recorded values are at or
+         *                            below (the middle of its bucket, but
+         *                            never outside the minimum and
+         *                            maximum).
+        */
+        uint32_t percentile(int percent) const;
+};
+
+/** How long each control tick actually lasted. */
+extern Histogram tickPeriodHistogram;
+
+/** How far each control tick was from TICK_LENGTH (longer or shorter). */
+extern Histogram tickJitterHistogram;
+
+/**
+ * How long the work in each control tick took (everything from sampling the
+ * controller until waiting for the next tick).
+*/
+extern Histogram tickWorkHistogram;
+
+/**
+ * How long after the controller was sampled a drive motor was first sent the
+ * velocity it led to. Each change of a wheel's velocity is stamped with the
+ * time its input was sampled (see Wheel::stampInput()), and recorded by
+ * Wheel::control() in the wheel control task once it sends the new velocity.
+*/
+extern Histogram inputLatencyHistogram;
+
+/** How long movement() took to run. */
+extern Histogram movementTimeHistogram;
+
+/**
+ * How long each intake and lift command waited in actuatorQueue, from the
+ * button event posting it until the motors were set (see actuatorCommands.h).
+*/
+extern Histogram commandLatencyHistogram;
+
+/**
+ * How many commands were waiting in actuatorQueue each tick (only ticks with
+ * at least one).
+*/
+extern Histogram commandDepthHistogram;
+
+/**
+ * How long each emergency stop took, from the last time the button was seen
+ * let go until every motor was told to stop (see emergencyStop.h).
+*/
+extern Histogram stopLatencyHistogram;
+
+/**
+ * How late the watchdog caught each stalled loop, after the loop was
+ * WATCHDOG_MARGIN late (see watchdog.h).
+*/
+extern Histogram stallDetectionHistogram;
+
+/** How long each of the watchdog's checks took. */
+extern Histogram watchdogCheckHistogram;
+
+/**
+ * Records one control tick into the tick and movement histograms above.
+ * Called by the control loop right after movement().
+ * @param uint64_t movementStart    When movement() was called
+ *                                      (timer::systemHighResolution()).
+*/
+void recordControlTick(uint64_t movementStart);
+
+/**
+ * Clears all the histograms, for example at the start of driver control.
+*/
+void clearLatencyStats();
+
+/**
+ * Writes a small table of all the histograms (count, p50, p95, p99 and max)
+ * into `text`, one histogram per line. All in microseconds, except the
+ * command depth, which is a number of commands.
+ * @returns int   The length of the text written.
+*/
+int formatLatencyReport(char *text, int size);
+
+/**
+ * Writes the report from formatLatencyReport() to LATENCY_REPORT_FILE on the
+ * SD card. Slow, so it should not be called from the control loop.
+ * @returns bool  Whether there was an SD card to write to.
+*/
+bool saveLatencyReport();
+
+const char * const LATENCY_REPORT_FILE = "latency.txt";
+
+#endif
@@ -0,0 +1,111 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       motionProfile.h                                                 */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Acceleration and Jerk Limited Velocity Profile Declarations     */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef MOTION_PROFILE_HEADER_GUARD
+#define MOTION_PROFILE_HEADER_GUARD
+
+using namespace vex;
+
+/**
+ * How quickly a velocity is allowed to change.
+ *
+ * If the wheels speed up or slow down faster than the floor can push the robot,
+ * they slip (and the robot drifts, see functionality.cpp). Limiting the
+ * acceleration keeps them gripping. Limiting the jerk (how fast the
+ * acceleration itself changes) also rounds off the start and end of every
+ * speed change, so the robot does not lurch or tip.
+*/
+struct ProfileLimits {
+    /** The most the velocity may change per second (rpm/s). */
+    int32_t maxAcceleration;
+
+    /**
+     * The most the acceleration may change per second (rpm/s^2). 0 means no
+     * limit, which gives a trapezoid profile instead of an S-curve.
+    */
+    int32_t maxJerk;
+};
+
+/**
+ * Moves a velocity towards a goal velocity by at most the allowed amount each
+ * tick, so that it follows a trapezoid (acceleration limited) or S-curve
+ * (acceleration and jerk limited) profile. Call step() once per tick.
+ *
+ * Everything is in 16.16 fixed point (whole numbers with 16 bits after the
+ * point), so small changes are not rounded away and the goal is always
+ * reached exactly, however small the limits are. Accelerations are kept per
+ * tick instead of per second so a step is only additions and comparisons.
+*/
+class MotionProfile {
+    public:
+        /** 1.0 in 16.16 fixed point. */
+        static const int32_t ONE = 1 << 16;
+
+    private:
+        /* In rpm, rpm per tick, and rpm per tick per tick (all 16.16). */
+        int32_t velocity = 0;
+        int32_t acceleration = 0;
+        int32_t accelerationStep = 0;
+        int32_t jerkStep = 0;
+
+        /* How much of the way to the goal the last step went (16.16). */
+        int32_t progress = 0;
+
+        int32_t tickLength;
+
+    public:
+        /**
+         * @param ProfileLimits limits    How quickly the velocity may change.
+         * @param int tickLength          How long a tick is (ms).
+        */
+        MotionProfile(ProfileLimits limits, int tickLength);
+
+        /**
+         * Changes the limits. The current velocity and acceleration are kept.
+         * @param ProfileLimits limits    How quickly the velocity may change.
+        */
+        void setLimits(ProfileLimits limits);
+
+        /**
+         * Jumps straight to a velocity (like when the wheels are stopped with
+         * the brakes), with no acceleration.
+         * @param int velocity    The new velocity (rpm).
+        */
+        void reset(int velocity);
+
+        /**
+         * Moves the velocity one tick further towards the goal.
+         * @param int goal        The velocity wanted (rpm).
+         * @returns int           The new velocity, rounded to the nearest rpm.
+        */
+        int step(int goal);
+
+        /**
+         * Moves the velocity part of the way to the goal instead of following
+         * the limits, so that it keeps in step with another profile (like one
+         * wheel following another while turning, see updateWheels()).
+         * @param int goal            The velocity wanted (rpm).
+         * @param int32_t progress    How much of the way to go (16.16), from
+         *                                the other profile's getProgress().
+         * @returns int               The new velocity, rounded to the nearest
+         *                                rpm.
+        */
+        int follow(int goal, int32_t progress);
+
+        /** @returns int32_t    How much of the way to the goal the last step went (16.16, ONE is all of it). */
+        int32_t getProgress() const { return progress; }
+
+        /** @returns int    The velocity, rounded to the nearest rpm. */
+        int getVelocity() const { return (velocity + (velocity >= 0 ? ONE / 2 : -ONE / 2)) / ONE; }
+
+        /** @returns int32_t    The acceleration (rpm/s). */
+        int32_t getAcceleration() const { return (int32_t)((int64_t)acceleration * 1000 / tickLength / ONE); }
+};
+
+#endif
@@ -0,0 +1,157 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       motorCache.h                                                    */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Motor Command Cache Declarations                                */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef MOTOR_CACHE_HEADER_GUARD
+#define MOTOR_CACHE_HEADER_GUARD
+
+#include <atomic>
+
+using namespace vex;
+
+/**
+ * How long (in milliseconds) a cached command is trusted before it is sent to
+ * the motor again anyway, in case the motor missed it (unplugged cable, etc.).
+*/
+const uint32_t MOTOR_CACHE_REFRESH_TIME = 500;
+
+/**
+ * Why every motor was halted (see CachedMotor::halt()). Each is a bit, so one
+ * can not take back another's halt.
+*/
+enum haltReasons {
+    emergencyStopHalt = 1,
+    watchdogHalt = 2
+};
+
+/**
+ * Sits between our code and a motor, and only sends a command to the motor if
+ * it would change what the motor is doing.
+ *
+ * The drive code decides what every motor should be doing every tick, so most
+ * ticks it asks the motors to keep doing exactly what they are already doing
+ * (the same velocity, or stopping again while the stick is let go). Each of
+ * those commands still goes over the smart port and costs time in the tick.
+ *
+ * All commands for a motor MUST go through its CachedMotor. If something
+ * commands the motor directly, call invalidate() afterwards so the next
+ * command is sent no matter what. Reading from the motor (velocity,
+ * temperature, ...) is still done on the motor itself.
+*/
+class CachedMotor {
+    private:
+        enum class Command { none, spin, voltage, stop };
+
+        /* The last command sent, and when (from timer::systemHighResolution()). */
+        Command lastCommand = Command::none;
+        uint64_t lastSent = 0;
+
+        directionType direction = directionType::fwd;
+        brakeType stopping = brakeType::coast;
+
+        /* The velocity setting of the motor, and the velocity it was spun at. */
+        bool velocityKnown = false;
+        bool torqueKnown = false;
+        double torqueSetting = 100;
+        double velocitySetting = 0;
+        velocityUnits velocitySettingUnits = velocityUnits::rpm;
+        double spinVelocity = 0;
+        double spinVoltage = 0;
+
+        uint32_t sent = 0;
+        uint32_t suppressed = 0;
+
+        /* One bit per reason the motors are halted for. */
+        static std::atomic<uint32_t> halted;
+
+        /* Whether the last command was sent too long ago to trust (see MOTOR_CACHE_REFRESH_TIME). */
+        bool stale();
+        void countSent();
+        void countSuppressed();
+
+    public:
+        /** The motor the commands are sent to. */
+        motor *device;
+
+        /** Totals over every CachedMotor. */
+        static uint32_t totalSent;
+        static uint32_t totalSuppressed;
+
+        /**
+         * Latches every CachedMotor so that only stop() gets through to the
+         * motors until resume(), whatever the rest of the code asks for (see
+         * emergencyStop()). Commands that are refused are not sent, counted or
+         * cached.
+         * @param uint32_t reason     Who halted them (from `haltReasons`). The
+         *                                motors stay halted until every reason
+         *                                has been resumed.
+        */
+        static void halt(uint32_t reason);
+
+        /** Takes back a halt() for one reason. */
+        static void resume(uint32_t reason);
+
+        /** @returns bool   Whether the motors are halted for any reason (see halt()). */
+        static bool isHalted() { return halted.load(std::memory_order_acquire) != 0; }
+
+        /** @returns bool   Whether the motors are halted for this reason. */
+        static bool isHalted(uint32_t reason) { return (halted.load(std::memory_order_acquire) & reason) != 0; }
+
+        CachedMotor(motor &device);
+
+        /**
+         * Sets the velocity used by spin(directionType). Like the motor's own
+         * setVelocity(), this does not change what the motor is doing now.
+        */
+        void setVelocity(double velocity, velocityUnits units);
+
+        /**
+         * Limits how much current (and so torque) the motor may draw, whatever
+         * it is told to do (see thermal.h).
+         * @param double percent  The limit, as a percentage of the most it can draw.
+        */
+        void setMaxTorque(double percent);
+
+        /**
+         * Spins the motor at the velocity set with setVelocity().
+        */
+        void spin(directionType dir);
+
+        /**
+         * Spins the motor at the given velocity (one command instead of
+         * setVelocity() and spin()).
+        */
+        void spin(directionType dir, double velocity, velocityUnits units);
+
+        /**
+         * Spins the motor at a voltage instead of a velocity (for our own
+         * velocity controller, see velocityController.h).
+        */
+        void spin(directionType dir, double voltage, voltageUnits units);
+
+        void stop(brakeType mode);
+
+        /**
+         * Forgets what was last sent, so the next command is always sent.
+        */
+        void invalidate();
+
+        /** @returns uint32_t   Commands actually sent to this motor. */
+        uint32_t getSent() { return sent; }
+
+        /** @returns uint32_t   Commands not sent because nothing would change. */
+        uint32_t getSuppressed() { return suppressed; }
+
+        /**
+         * @returns uint64_t   When a command was last actually sent to the motor
+         *                         (timer::systemHighResolution(), µs).
+        */
+        uint64_t getLastSentTime() { return lastSent; }
+};
+
+#endif
@@ -0,0 +1,162 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       odometry.h                                                      */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Robot Position Tracking Declarations                            */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef ODOMETRY_HEADER_GUARD
+#define ODOMETRY_HEADER_GUARD
+
+#include "vex.h"
+#include <atomic>
+
+using namespace vex;
+
+/**
+ * How often (in milliseconds) the position is updated.
+*/
+const int ODOMETRY_PERIOD = 10;
+
+/** The diameter of the drive wheels (inches). */
+constexpr double WHEEL_DIAMETER = 4.0;
+
+/** Wheel turns per motor turn (the wheels are driven straight off the motors). */
+constexpr double DRIVE_GEAR_RATIO = 1.0;
+
+/** The distance between the middle of the left and right wheels (inches). */
+constexpr double TRACK_WIDTH = 12.5;
+
+/**
+ * How much of the way the heading is pulled towards the inertial sensor each
+ * update (0 to 1), see Odometry.
+*/
+const double INERTIAL_TRUST = 0.2;
+
+/**
+ * Where the robot is on the field, and how fast it is moving.
+ *
+ * The field is measured in inches from wherever the robot started (or was
+ * last put with resetOdometry()): y is straight ahead of where the robot
+ * started and x is to its right. The heading is in degrees clockwise from
+ * straight ahead, like a compass (and like the inertial sensor). It is not
+ * wrapped around, so two turns to the right is 720.
+*/
+struct Pose {
+    double x, y;
+    double heading;
+
+    /** How fast the robot is moving forward (inches/s) and turning (degrees/s). */
+    double velocity, angularVelocity;
+
+    /** When the pose was worked out (timer::system(), ms). */
+    uint32_t time;
+};
+
+/**
+ * Works out the pose from how far each side of the drive has turned and the
+ * heading from the inertial sensor.
+ *
+ * The distance travelled comes from the drive encoders (in the motors). The
+ * heading change comes from them too, since they react straight away and do
+ * not drift, but they over-count turns: the wheels scrub sideways while the
+ * robot turns. The inertial sensor does not scrub but slowly drifts, so every
+ * update the heading is pulled INERTIAL_TRUST of the way towards it. That
+ * keeps the encoders' quick response without letting their error build up
+ * (a complementary filter).
+*/
+class Odometry {
+    private:
+        Pose pose;
+        double trust;
+
+        /* The last readings, to work out how much changed. */
+        bool started = false;
+        double lastLeft = 0, lastRight = 0;
+
+        /* The inertial sensor's rotation when the heading was 0 (once it is ready). */
+        bool inertialKnown = false;
+        double inertialOffset = 0;
+
+    public:
+        /**
+         * @param double trust    How much to trust the inertial sensor (see
+         *                            INERTIAL_TRUST). 0 uses only the encoders.
+        */
+        Odometry(double trust);
+
+        /**
+         * Moves the pose on by one update.
+         * @param double left       How far the left side has turned (motor turns).
+         * @param double right      How far the right side has turned (motor turns).
+         * @param double inertial   The inertial sensor's rotation (degrees), or
+         *                              NAN if it isn't ready.
+         * @param uint32_t time     Now (timer::system(), ms).
+        */
+        void update(double left, double right, double inertial, uint32_t time);
+
+        /**
+         * Puts the robot at a pose. The next update starts counting from there.
+         * @param double inertial   The inertial sensor's rotation right now, or
+         *                              NAN.
+        */
+        void reset(double x, double y, double heading, double inertial);
+
+        const Pose &getPose() { return pose; }
+};
+
+/**
+ * The newest pose, published by the odometry task and read by anything else
+ * (autonomous, the debug screen) without ever waiting on it.
+ *
+ * A sequence number is odd while a pose is being written. A reader copies the
+ * pose, and if the number was odd or changed while it copied, it copies again.
+*/
+class PoseSnapshot {
+    private:
+        std::atomic<uint32_t> sequence;
+        Pose pose;
+
+    public:
+        PoseSnapshot() : sequence(0), pose() {}
+
+        void publish(const Pose &pose);
+
+        /** @returns Pose    A copy of the newest pose. */
+        Pose read();
+};
+
+extern PoseSnapshot robotPose;
+
+/**
+ * @returns Pose    Where the robot is right now (see Pose).
+*/
+inline Pose getRobotPose() { return robotPose.read(); }
+
+/**
+ * How long the last odometry update took (µs), and the longest one.
+*/
+extern uint32_t odometryUpdateTime, odometryWorstUpdateTime;
+
+/**
+ * Tells odometry that the robot is at this pose (like at the start of
+ * autonomous, against a known wall).
+*/
+void resetOdometry(double x, double y, double heading);
+
+/**
+ * Reads the encoders and the inertial sensor, and publishes the new pose. The
+ * odometry task does this every ODOMETRY_PERIOD milliseconds.
+*/
+void updateOdometry();
+
+/**
+ * Calibrates the inertial sensor and starts the odometry task. Until the
+ * sensor has finished calibrating (about 2 seconds), only the encoders are
+ * used. Called once by vexcodeInit().
+*/
+void startOdometry();
+
+#endif
@@ -0,0 +1,144 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       pathFollower.h                                                  */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Spline Paths and Pure Pursuit Declarations                      */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef PATH_FOLLOWER_HEADER_GUARD
+#define PATH_FOLLOWER_HEADER_GUARD
+
+#include "vex.h"
+#include "odometry.h"
+#include "driveMoves.h"
+#include "routes.h"
+
+using namespace vex;
+
+/** The most points a Path can have. */
+const int MAX_PATH_POINTS = 256;
+
+/**
+ * How far apart the points of a Path are (inches). Long paths spread their
+ * points further apart so they fit in MAX_PATH_POINTS.
+*/
+const double PATH_SPACING = 1.0;
+
+/**
+ * How far ahead of the robot the follower aims (inches), see PurePursuit.
+ * It grows with speed: LOOKAHEAD_TIME seconds of travel, between
+ * MIN_LOOKAHEAD and MAX_LOOKAHEAD.
+*/
+const double MIN_LOOKAHEAD = 6.0;
+const double MAX_LOOKAHEAD = 18.0;
+const double LOOKAHEAD_TIME = 0.8;
+
+/** One point along a Path. */
+struct PathPoint {
+    double x, y;
+    /** How far along the path this point is (inches). */
+    double distance;
+    /** The fastest the middle of the robot may go here (rpm). */
+    double speed;
+};
+
+/**
+ * A smooth path through a list of waypoints, as points PATH_SPACING apart.
+ *
+ * The path is the spline through the waypoints (see splineAt()). Each point gets a speed limit, so that the
+ * outside wheels never go faster than the top speed on curves and the robot
+ * can still slow down in time for the tighter ones.
+ *
+ * Like the turns in driveMoves.h, paths are mirrored on the left side (x is
+ * multiplied by MIRROR), so they are written once for the right side.
+*/
+class Path {
+    private:
+        PathPoint points[MAX_PATH_POINTS];
+        int size = 0;
+
+    public:
+        /**
+         * @param const Waypoint *waypoints   Where the path goes, starting
+         *                                        where the robot is.
+         * @param int count                   How many waypoints (at least 2).
+         * @param int speed                   The top speed along the path
+         *                                        (rpm).
+        */
+        Path(const Waypoint *waypoints, int count, int speed = MOVE_SPEED);
+
+        /** @returns int    How many points the path has. */
+        int getSize() const { return size; }
+
+        /** @returns double    How long the path is (inches). */
+        double getLength() const { return points[size - 1].distance; }
+
+        const PathPoint &operator[](int index) const { return points[index]; }
+};
+
+/**
+ * Steers the robot along a Path with pure pursuit: each tick it picks the
+ * point on the path one lookahead distance ahead of the robot and drives
+ * along the circle that reaches it. A longer lookahead is smoother, a shorter
+ * one follows tight curves more closely, so the lookahead grows with speed.
+ *
+ * A step only looks at the points near where the robot was last time, so it
+ * costs the same however long the path is.
+*/
+class PurePursuit {
+    private:
+        const Path &path;
+
+        /* The point of the path closest to the robot. */
+        int closest = 0;
+
+    public:
+        PurePursuit(const Path &path) : path(path) {}
+
+        /**
+         * Works out the wheel velocities for one tick.
+         * @param const Pose &pose    Where the robot is.
+         * @param int speed           The top speed of any wheel (rpm).
+         * @param double &left        Set to the left wheels' velocity (rpm).
+         * @param double &right       Set to the right wheels' velocity (rpm).
+         * @returns double            How far the robot still has to go along
+         *                                the path (inches, negative once it
+         *                                has gone past the end).
+        */
+        double step(const Pose &pose, int speed, double &left, double &right);
+
+        /** Starts following the path from the beginning again. */
+        void reset() { closest = 0; }
+
+        /** @returns int    The point of the path closest to the robot at the last step. */
+        int getClosest() const { return closest; }
+};
+
+/** The action behind followPath(). */
+class FollowPath : public DriveMove {
+    private:
+        PurePursuit pursuit;
+        int speed;
+
+    protected:
+        void startMove(const Pose &pose);
+        double drive(const Pose &pose);
+
+    public:
+        FollowPath(const Path &path, int speed = MOVE_SPEED, ExitConditions exit = PATH_EXIT)
+            : DriveMove(exit), pursuit(path), speed(speed) {}
+};
+
+/**
+ * Drives along a path without stopping, steering with pure pursuit.
+ * @param const Path &path        Where to go, starting where the robot is.
+ * @param int speed               The top speed of any wheel (rpm).
+ * @param ExitConditions exit     When the move is finished (tolerance in
+ *                                    inches from the end).
+ * @returns bool                  Whether it got there before the timeout.
+*/
+bool followPath(const Path &path, int speed = MOVE_SPEED, ExitConditions exit = PATH_EXIT);
+
+#endif
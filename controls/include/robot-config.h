@@ -46,42 +46,24 @@ const int TICK_LENGTH = 50;
 */
 const int NUM_WHEEL_TRAINS = 2;
 
-/**
- * The amount that the percentOfMaxSpeed should change per tick when the
- * appropriate control is held down. Is 1% per tick.
-*/
-double constexpr PERCENTOFMAXSPEEDSTEP = 0.05; 
+
+#include "motorCache.h"
+#include "motionProfile.h"
+#include "velocityController.h"
+#include "traction.h"
+#include "input.h"
+#include "stickCurves.h"
 
 /**
- * The percentage of the max speed (200 rpm) that the wheels should move
- * when at full speed. Defaults to 75%.
-*/
-extern double percentOfMaxSpeed;
-
-/*
-  * The rate at which the velocity of the robot's wheel trains moves toward their
-  * respective goal velocities. Should be constant so that we have a constant
-  * change in the velocity (a linear model).
-  *
-  * Proportional to the acceleration of the wheels.
-  *
-  * Can (and should) be modified in the autonomous to make things go smoother.
-  *
-  * Should be between 0 and 1. An accelerational constant of 1 means that the
-  * wheel's velocity will immediately go up to the goalVelocity (which means
-  * there is no gradual acceleration). An accelerational constant of 0 means
-  * that the wheel's velocity will never change.
-  *
-  * A good rule for determining the accelerational constant is using this:
-  * ANGULAR_ACCELERATIONAL_CONSTANT = 1/(ticks), where ticks is the number of
-  * ticks that should pass between the time the wheel starts accelerating
-  * and when it reaches its goalVelocity. 
-  *
-  * For example, an accelerational constant of 1/20 would result in the wheel
-  * accelerating to its goal velocity over 20 ticks (approximately 400 ms or
-  * 2/5 of a second when the ticklength is 20 ms).
+ * How quickly the wheels may speed up and slow down (see ProfileLimits).
+ *
+ * DRIVER_LIMITS are used during driver control. Full speed (50 rpm) is
+ * reached in about a quarter of a second, which is about as fast as the
+ * wheels can go without slipping. AUTONOMOUS_LIMITS are gentler, because
+ * in autonomous where the robot ends up matters more than how quickly.
 */
-extern double angular_accelerational_constant; 
+constexpr ProfileLimits DRIVER_LIMITS = {250, 2500};
+constexpr ProfileLimits AUTONOMOUS_LIMITS = {150, 1000};
 
 /**
  * A wrapper for motor class that implements gradual acceleration.
@@ -90,35 +72,63 @@ extern double angular_accelerational_constant;
 class Wheel {
     private:
         /*
-         * double   The velocity at which the motor will be turning (not
-         * necessarily at this moment) (measured in rpm).
+         * int   The velocity at which the motor is being told to turn right
+         * now (measured in rpm). Moves towards goalVelocity a little each
+         * tick (see updateVelocity()).
         */
         int velocity = 0;
 
         /*
-         * double   The velcoity at which we want the motor to be turning soon
+         * int   The velcoity at which we want the motor to be turning soon
          * (measured in rpm). Used for implementing gradual acceleration.
          * To prevent the robot from slipping initially.
         */
         int goalVelocity = 0;
 
         /*
-         * double   The velocity the wheel was moving at when the analog stick moved.
+         * bool   Whether the last updateVelocity() or followVelocity()
+         * changed `velocity`.
+        */
+        bool changed = false;
+
+        /*
+         * uint64_t   When the controller was read for the newest change of
+         * `velocity` that control() has not sent yet, 0 if there is none
+         * (see stampInput()).
+        */
+        uint64_t inputTime = 0;
+
+        /*
+         * MotionProfile   Works out how far velocity moves towards
+         * goalVelocity each tick.
+        */
+        MotionProfile profile;
+
+        /*
+         * VelocityController   Works out the voltage that keeps the motor
+         * at `velocity` (see control()).
         */
-        int initialVelocity = 0;
+        VelocityController controller;
 
         /*
-         * double   The rate at which the robot's velocity is changing in order
-         * to reach the goalVelocity. Proportional to the
-         * ANGULAR_ACCELERATIONAL_CONSTANT.
+         * TractionControl   Holds `velocity` back from the velocity
+         * controller while the wheel slips (see control()).
         */
-        int acceleration = 0;
+        TractionControl traction;
+
+        /*
+         * Brakes the motor if the wheel has come to a stop and is meant to
+         * stay there, without waiting for control(), unless traction control
+         * is still slowing it down (see TractionControl::canStop()).
+        */
+        void brakeIfStopped();
 
     public:
 
         /**
          * The default constructor for the Wheel class. It takes the motor it 
-         * is intended to wrap, and stores that motor.
+         * is intended to wrap, and sends all its commands through a
+         * CachedMotor (see motorCache.h).
         */
         Wheel(motor &wheelMotor);
 
@@ -128,77 +138,113 @@ class Wheel {
         int getVelocity() { return velocity; }
 
         /**
-         * @param double  The new velocity of the wheel.
+         * Jumps straight to a velocity, with no gradual acceleration (for
+         * stopping). The goal velocity is set too, so the wheel stays there.
+         * @param int  The new velocity of the wheel.
         */
         void setVelocity(int velocity) {
             this->velocity = velocity;
+            this->goalVelocity = velocity;
+            profile.reset(velocity);
+            traction.jump(velocity);
         }
 
         /**
-         * @returns double    The wheel's goal velocity we want.
+         * @returns int    The wheel's goal velocity we want.
         */
         int getGoalVelocity() { return goalVelocity; }
 
         /**
-         * Sets the goal velocity. 
-         * Updates the acceleration of the wheel accordingly.
-         * @param double    The new goal velocity we want.
+         * Sets the goal velocity. The wheel gets there gradually, see
+         * updateVelocity().
+         * @param int    The new goal velocity we want.
         */
         void setGoalVelocity(int goalVel) {
-            // Only have change in acceleration if there is a change in goal velocity
-            // (We don't want to have the acceleration decrease unnecessarily,
-            // particularly in autonomous).
-            if(this->goalVelocity != goalVel) { 
-                // (final-initial) * accelerational_constant
-                this->goalVelocity = goalVel;
-                this->initialVelocity = this->velocity;
-            }
+            this->goalVelocity = goalVel;
         }
 
         /**
-         * @return double   The initial velocity.
+         * @returns int32_t   How quickly the velocity is changing (rpm/s).
         */
-        int getInitialVelocity() {
-            return initialVelocity;
+        int32_t getAcceleration() {
+            return profile.getAcceleration();
         }
 
         /**
-         * @param double   The initial velocity.
+         * Changes how quickly the wheel may speed up and slow down (like
+         * DRIVER_LIMITS or AUTONOMOUS_LIMITS).
+         * @param ProfileLimits limits    The new limits.
         */
-        void setInitialVelocity(int initialVelocity) {
-            this->initialVelocity = initialVelocity;
+        void setLimits(ProfileLimits limits) {
+            profile.setLimits(limits);
         }
 
-        int getAcceleration() {
-            return acceleration;
-        }
+        /**
+         * @returns TractionControl &   What caught the wheel slipping (see
+         *                                  traction.h).
+        */
+        TractionControl &getTraction() { return traction; }
 
         /*
-         * motor    The motor that this wheel is controlled by.
+         * CachedMotor  The motor that this wheel is controlled by. Commands
+         * that would not change what the motor is doing are not sent.
         */
-        motor *wheelMotor;
+        CachedMotor wheelMotor;
 
         /*
-         * A method to control drifting and changing of direction when the
-         * robot first starts to move. This allows us to gradually change the
-         * velocity of the robot so that we do not have kinetic friction
-         * between the robot's wheels and the floor.
-         *
-         * The model for the increase in acceleration should be linear. It
-         * should slope up in the case that the desired velocity is positive.
-         * The slope will be negative when 
-         * This gives us a constant acceleration.
+         * Moves the velocity one tick closer to the goal velocity. The wheel
+         * control task picks it up within a WHEEL_CONTROL_PERIOD (see
+         * control()), except that a wheel told to stop brakes straight away.
+         * Called once per tick, in driver control and in autonomous.
          *
-         * The rate at which this occurs is proportional to the 
-         * ACCELERATIONAL_CONSTANT, which will allow us to adjust the rate of
-         * acceleration so that the driver has the most control over the
-         * robot's movement.
-         *
-         * This will be called once per tick.
+         * This is what stops the robot from drifting when it first starts to
+         * move. The velocity follows an S-curve (see MotionProfile), so the
+         * wheels keep static friction with the floor.
+        */
+        void updateVelocity();
+
+        /*
+         * Like updateVelocity(), but moves the same part of the way to the
+         * goal velocity as another wheel did, so the two stay in proportion.
+         * @param int32_t progress    The other wheel's getProgress().
+        */
+        void followVelocity(int32_t progress);
+
+        /*
+         * @returns int32_t   How much of the way to the goal velocity the
+         *                        last update went (16.16 fixed point).
+        */
+        int32_t getProgress() { return profile.getProgress(); }
+
+        /*
+         * Marks the change of velocity the last updateVelocity() or
+         * followVelocity() made (if it made one) as coming from the
+         * controller read at `time`. control() records how long after that
+         * it first sent the new velocity in inputLatencyHistogram (see
+         * latency.h).
+         * @param uint64_t time   When the controller was read
+         *                            (InputFrame::time).
+        */
+        void stampInput(uint64_t time) {
+            if(changed) { inputTime = time; }
+        }
+
+        /*
+         * Runs the velocity controller once: measures how fast the motor is
+         * really going and sets its voltage so that it keeps to `velocity`
+         * (or brakes, once it is stopped and can be braked without
+         * slipping). While the wheel slips, it is
+         * held to a lower velocity until it grips again (see
+         * TractionControl). The voltage is scaled for the battery (see
+         * batteryScale()). Without this, the motors are only
+         * asked for a velocity, and one side of the drive falling behind
+         * under load makes the robot curve.
          *
-         * V = initialV + (acceleration)(time)
+         * Only called every WHEEL_CONTROL_PERIOD by the wheel control task
+         * (see startWheelControl()), so the controller always works over the
+         * same period.
         */
-        void calculateAcceleratingVelocity();
+        void control();
 
         /*
          * Spins the motor that controls this wheel at the velocity stored in
@@ -219,6 +265,12 @@ class Wheel {
          *                                want (forward or backward)
         */
         void spin(int velocity, directionType dir);
+
+        /*
+         * Stops the motor that controls this wheel.
+         * @param brakeType mode      How the motor should stop.
+        */
+        void stop(brakeType mode);
 };
 
 /**
@@ -230,6 +282,16 @@ class Wheel {
 extern motor rightWheelTrainMotor;
 extern motor leftWheelTrainMotor;
 
+/** The inertial sensor, for the robot's heading (see odometry.h). */
+extern inertial inertialSensor;
+
+/**
+ * The optical sensors that see balls at the intake's mouth and at the top of
+ * the lift (see indexer.h).
+*/
+extern optical mouthSensor;
+extern optical topSensor;
+
 /** The left intake motor. Reversed here because it's reversed on the robot. */
 extern motor intakeLeftMotor; 
 /** The right intake motor. */
@@ -247,6 +309,15 @@ extern motor liftTopMotor;
 /** The right lift motor. Reversed here because it's reversed on the robot. */
 extern motor liftBottomMotor;
 
+/**
+ * All commands to the intake and lift motors go through these, so that only
+ * commands that change what a motor is doing are sent (see motorCache.h).
+*/
+extern CachedMotor intakeLeft;
+extern CachedMotor intakeRight;
+extern CachedMotor liftTop;
+extern CachedMotor liftBottom;
+
 //Wheels
 extern Wheel rightWheelTrain;
 extern Wheel leftWheelTrain;
@@ -256,20 +327,38 @@ extern Wheel leftWheelTrain;
 */
 extern Wheel *wheelTrains[NUM_WHEEL_TRAINS]; 
 
+/** The number of motors on the robot (both wheel trains, the intake and the lift). */
+const int NUM_MOTORS = 6;
+
+/**
+ * Every motor on the robot, through its CachedMotor (the wheel trains' too),
+ * so they can all be stopped at once (see emergencyStop()).
+*/
+extern CachedMotor *allMotors[NUM_MOTORS];
+
 /**
  * The following are all the controls on the controller. The axes represent
- * one axis of one analog stick.
+ * one axis of one analog stick. Axes and buttons that are polled every tick
+ * are read from the tick's InputFrame (see input.h), the rest use events.
 */
 
 /** The vertical axis of the left (movement) analog stick */
-extern vex::controller::axis forwardAxis; 
+const InputAxis forwardAxis = Axis3; 
 /** The horizontal axis of the turning analog axis */
-extern vex::controller::axis turningAxis;
+const InputAxis turningAxis = Axis1;
+
+/** Button that switches to the fast speed mode (see stickCurves.h). */
+const InputButton speedUp = ButtonUp;
+/** Button that switches to the slow speed mode (see stickCurves.h). */
+const InputButton speedDown = ButtonDown;
 
-/** Button that causes the wheel motor percentOfMaxSpeed to increase. */
-extern vex::controller::button speedUp;
-/** Button that causes the wheel motor percentOfMaxSpeed to increase. */
-extern vex::controller::button speedDown;
+/**
+ * Button that switches the debug screen between the normal page, the latency
+ * page (see latency.h), the position page (see odometry.h), the safety
+ * page (see watchdog.h) and the indexer page (see indexer.h). Opening the
+ * latency page also saves the latency report to the SD card.
+*/
+const InputButton showLatency = ButtonY;
 
 /** Button that causes the intake motors to intake and lift balls. */
 extern vex::controller::button functionUp;
@@ -281,12 +370,14 @@ extern vex::controller::button functionExpel;
 
 /**
  * Button that immediately stops all motors and makes them brake (using
- * brakeType brake).
+ * brakeType brake), for as long as it is held (see emergencyStop.h).
  *
  * An extremely rare phenomenon is that the motors don't stop moving, refuze
  * to change direction, or otherwise become unresponsive. If this were to
  * happen during a match, this could cause problems. If the robot starts to run
  * away, then hit this button to immediately stop it from moving. 
+ *
+ * B, because nothing else uses it (ButtonDown is speedDown).
 */
 extern vex::controller::button stopMotors;
 
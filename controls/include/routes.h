@@ -0,0 +1,123 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       routes.h                                                        */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Autonomous Routes and the Spline Through Them                   */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef ROUTES_HEADER_GUARD
+#define ROUTES_HEADER_GUARD
+
+#include "vex.h"
+#include "driveMoves.h"
+
+using namespace vex;
+
+/** A point a path goes through (inches, in the same field as Pose). */
+struct Waypoint {
+    double x, y;
+};
+
+/**
+ * A route for autonomous, written for the right side (it is mirrored for the
+ * left side, see MIRROR). Every route listed in ROUTES gets a trajectory
+ * table (see trajectories.h).
+*/
+struct Route {
+    const char *name;
+    const Waypoint *waypoints;
+    int count;
+    /** The top speed of any wheel (rpm). */
+    int speed;
+};
+
+/* Across the field past the home row goals, at the end of autonomous (see autonomous.h). */
+constexpr Waypoint HOME_ROW_WAYPOINTS[] = {{0, 0}, {0, 20}, {20, 40}, {50, 40}, {70, 24}, {96, 24}};
+constexpr Route HOME_ROW = {"HOME_ROW", HOME_ROW_WAYPOINTS, sizeof(HOME_ROW_WAYPOINTS) / sizeof(Waypoint), MOVE_SPEED};
+
+/** Every route that has a trajectory table. */
+constexpr const Route *ROUTES[] = {&HOME_ROW};
+constexpr int NUM_ROUTES = sizeof(ROUTES) / sizeof(ROUTES[0]);
+
+/*
+ * The path through a route's waypoints is a Catmull-Rom spline, which goes
+ * through every waypoint and curves smoothly between them. Path (see
+ * pathFollower.h) and the trajectory generator (tools/trajectoryGen.cpp) both
+ * use these, so they follow the same curve.
+*/
+
+/**
+ * Waypoint i, mirrored. Past the ends the route carries straight on, so the
+ * spline starts and ends straight.
+ * @param int mirror    1, or -1 to mirror the route (see MIRROR).
+*/
+inline Waypoint routeWaypoint(const Waypoint *waypoints, int count, int i, int mirror) {
+    Waypoint point;
+    if(i < 0) {
+        point.x = 2 * waypoints[0].x - waypoints[1].x;
+        point.y = 2 * waypoints[0].y - waypoints[1].y;
+    } else if(i >= count) {
+        point.x = 2 * waypoints[count - 1].x - waypoints[count - 2].x;
+        point.y = 2 * waypoints[count - 1].y - waypoints[count - 2].y;
+    } else {
+        point = waypoints[i];
+    }
+    point.x *= mirror;
+    return point;
+}
+
+/**
+ * A point on the spline, or how fast it changes there.
+ * @param int segment     Which stretch (from waypoint `segment` to the next).
+ * @param double t        How far along the stretch (0 to 1).
+ * @param int mirror      1, or -1 to mirror the route.
+ * @param int derivative  0 for the point, 1 for its first derivative (the
+ *                            direction of the path) and 2 for its second
+ *                            derivative (how it bends).
+*/
+inline Waypoint splineAt(const Waypoint *waypoints, int count, int segment, double t, int mirror, int derivative = 0) {
+    Waypoint p0 = routeWaypoint(waypoints, count, segment - 1, mirror), p1 = routeWaypoint(waypoints, count, segment, mirror);
+    Waypoint p2 = routeWaypoint(waypoints, count, segment + 1, mirror), p3 = routeWaypoint(waypoints, count, segment + 2, mirror);
+    //0.5 * (a + b t + c t^2 + d t^3)
+    Waypoint a = {2 * p1.x, 2 * p1.y};
+    Waypoint b = {p2.x - p0.x, p2.y - p0.y};
+    Waypoint c = {2 * p0.x - 5 * p1.x + 4 * p2.x - p3.x, 2 * p0.y - 5 * p1.y + 4 * p2.y - p3.y};
+    Waypoint d = {3 * p1.x - p0.x - 3 * p2.x + p3.x, 3 * p1.y - p0.y - 3 * p2.y + p3.y};
+    Waypoint point;
+    if(derivative == 0) {
+        point.x = 0.5 * (a.x + b.x * t + c.x * t * t + d.x * t * t * t);
+        point.y = 0.5 * (a.y + b.y * t + c.y * t * t + d.y * t * t * t);
+    } else if(derivative == 1) {
+        point.x = 0.5 * (b.x + 2 * c.x * t + 3 * d.x * t * t);
+        point.y = 0.5 * (b.y + 2 * c.y * t + 3 * d.y * t * t);
+    } else {
+        point.x = 0.5 * (2 * c.x + 6 * d.x * t);
+        point.y = 0.5 * (2 * c.y + 6 * d.y * t);
+    }
+    return point;
+}
+
+/*
+ * A fingerprint of a route and everything its trajectory depends on, so the
+ * build can tell when a trajectory table is out of date (see
+ * trajectories.cpp). Coordinates count to 1/64 of an inch.
+*/
+constexpr uint64_t fingerprintStep(uint64_t fingerprint, double value) {
+    return fingerprint * 1099511628211ULL + (uint64_t)(int64_t)(value * 64);
+}
+
+constexpr uint64_t waypointsFingerprint(const Waypoint *waypoints, int count, uint64_t fingerprint) {
+    return count == 0 ? fingerprint
+        : waypointsFingerprint(waypoints + 1, count - 1, fingerprintStep(fingerprintStep(fingerprint, waypoints->x), waypoints->y));
+}
+
+constexpr uint64_t routeFingerprint(const Route &route) {
+    return waypointsFingerprint(route.waypoints, route.count,
+        fingerprintStep(fingerprintStep(fingerprintStep(fingerprintStep(fingerprintStep(fingerprintStep(
+            14695981039346656037ULL, route.speed), TRACK_WIDTH), INCHES_PER_SECOND_PER_RPM * 1000),
+            AUTONOMOUS_LIMITS.maxAcceleration), MOVE_BRAKING * 1000), TICK_LENGTH));
+}
+
+#endif
@@ -0,0 +1,97 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       stickCurves.h                                                   */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Stick Response Curve Lookup Table Declarations                  */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef STICK_CURVES_HEADER_GUARD
+#define STICK_CURVES_HEADER_GUARD
+
+using namespace vex;
+
+/**
+ * How the sticks feel to a driver. Each profile has its own stick curves (see
+ * StickCurve) for every speed mode.
+ *
+ * classicProfile     Straight line, exactly what the robot always did.
+ * smoothProfile      Small deadband and a partly cubic curve, so small stick
+ *                        movements give finer control but full stick is
+ *                        still full speed.
+ * precisionProfile   A fully cubic curve, for lining up with goals.
+*/
+enum driverProfiles {
+    classicProfile = 0,
+    smoothProfile,
+    precisionProfile,
+    NUM_DRIVER_PROFILES
+};
+
+/**
+ * The speed modes the driver switches between with the speedUp and speedDown
+ * buttons. SPEED_MODE_PERCENTS is the percentage of the stick value each one
+ * sends as rpm at full stick.
+*/
+enum speedModes {
+    fastSpeed = 0,
+    slowSpeed,
+    NUM_SPEED_MODES
+};
+
+constexpr int SPEED_MODE_PERCENTS[NUM_SPEED_MODES] = {40, 20};
+
+/**
+ * The number of values an axis can have (-127 to 127).
+*/
+const int STICK_VALUES = 255;
+
+/**
+ * Describes how a stick value turns into a wheel velocity. Everything is in
+ * whole numbers so that the tables can be made by the compiler.
+ *
+ * 1. The stick value is divided by `divisor` (the turning stick is halved).
+ * 2. Anything within `deadband` of the center is 0, and the rest is stretched
+ *    back out to the full range, so there is no jump at the deadband.
+ * 3. The result is bent by `expo` percent of a cubic curve: 0 is a straight
+ *    line, 100 is fully cubic. Either way full stick stays full stick.
+ * 4. It is scaled by `speedPercent` (like the old percentOfMaxSpeed).
+*/
+struct StickCurve {
+    int divisor;
+    int deadband;
+    int expo;
+    int speedPercent;
+};
+
+/**
+ * A stick curve worked out for every stick value, so that turning a stick
+ * value into a velocity is one array lookup.
+*/
+struct StickTable {
+    int16_t rpm[STICK_VALUES];
+
+    /** @returns int    The velocity (rpm) for a stick value (-127 to 127). */
+    constexpr int operator[](int32_t value) const { return rpm[value + 127]; }
+};
+
+/**
+ * The tables for the forward and turning sticks, for every driver profile and
+ * speed mode. Made at compile time in stickCurves.cpp, and kept in flash.
+*/
+extern const StickTable forwardTables[NUM_DRIVER_PROFILES][NUM_SPEED_MODES];
+extern const StickTable turningTables[NUM_DRIVER_PROFILES][NUM_SPEED_MODES];
+
+/**
+ * The driver profile in use. Set it to the profile of whoever is driving.
+*/
+extern int driverProfile;
+
+/**
+ * The speed mode in use, from `speedModes`. Changed by the speedUp and
+ * speedDown buttons.
+*/
+extern int speedMode;
+
+#endif
@@ -0,0 +1,230 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       telemetry.h                                                     */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Per Tick Telemetry Recorder Declarations                        */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef TELEMETRY_HEADER_GUARD
+#define TELEMETRY_HEADER_GUARD
+
+#include "vex.h"
+#include "telemetryFormat.h"
+#include <atomic>
+
+using namespace vex;
+
+/**
+ * What one wheel train was doing during a tick.
+*/
+struct TelemetryWheel {
+    /** The goal velocity (rpm, the motors never go past 100). */
+    int8_t goalVelocity;
+
+    /**
+     * How many times the wheel train has started slipping since the program
+     * started (see traction.h), wrapping after 255. The slips between two
+     * records are the difference of the two, so dropped records lose none.
+    */
+    uint8_t slips;
+
+    /** The velocity sent to the motor (rpm). */
+    int16_t velocity;
+
+    /** The velocity the motor measured, in tenths of an rpm. */
+    int16_t measuredVelocity;
+
+    /** The current the motor drew, in milliamps. */
+    uint16_t current;
+};
+
+/**
+ * One control tick, as written to the SD card. Fixed size and only made of
+ * integers so that recording one is just a copy, and so that a whole number of
+ * records fits in every block written to the SD card.
+ *
+ * The layout is described in each log by TELEMETRY_CHANNELS (see
+ * telemetryFormat.h), so fields can be added as long as a channel is added
+ * for them too.
+*/
+struct TelemetryRecord {
+    /** When the tick's controller input was sampled (µs, wraps after ~71 minutes). */
+    uint32_t time;
+
+    /**
+     * Counts every record made, including ones that were dropped (wraps after
+     * 65536), so readers can tell where records are missing.
+    */
+    uint16_t sequence;
+
+    /** The battery voltage, in millivolts. */
+    uint16_t batteryVoltage;
+
+    /** The value of each axis (-127 to 127), indexed by InputAxis. */
+    int8_t axes[NUM_AXES];
+
+    /**
+     * One bit per InputButton, like InputFrame#buttons. The top bit
+     * (TELEMETRY_AUTONOMOUS) is set for ticks of the autonomous period.
+    */
+    uint16_t buttons;
+
+    /** The temperature of each wheel train's motor, in degrees celsius. */
+    uint8_t temperatures[NUM_WHEEL_TRAINS];
+
+    /** In the same order as wheelTrains. */
+    TelemetryWheel wheels[NUM_WHEEL_TRAINS];
+};
+
+/** Set in TelemetryRecord#buttons for ticks of the autonomous period. */
+const uint16_t TELEMETRY_AUTONOMOUS = 1u << 15;
+
+static_assert(NUM_BUTTONS <= 15, "TelemetryRecord::buttons has no room for every button");
+static_assert(sizeof(TelemetryRecord) == 32, "TelemetryRecord should be 32 bytes (a power of two)");
+
+/**
+ * How many records are written to the SD card at once. 128 records are 4 KB,
+ * a whole number of SD card sectors.
+*/
+const uint32_t TELEMETRY_BLOCK_RECORDS = 128;
+
+/**
+ * A fixed size queue of records with exactly one producer (the control loop)
+ * and one consumer (the telemetry task), that neither of them ever has to wait
+ * for.
+ *
+ * The producer only ever writes `head` and the consumer only ever writes
+ * `tail`, so no lock is needed: each side publishes its progress with one
+ * atomic store after it is done with the records. Both counters only ever go
+ * up (wrapping around at 2^32), and CAPACITY is a power of two, so the slot
+ * of a record is just its counter masked by CAPACITY - 1 and the number of
+ * records waiting is `head - tail`.
+ *
+ * If the queue is full (the SD card fell far behind), then the new record is
+ * dropped and counted instead of waiting for room.
+*/
+class TelemetryBuffer {
+    public:
+        /** 1024 records are 51 seconds of ticks (32 KB). */
+        static const uint32_t CAPACITY = 8 * TELEMETRY_BLOCK_RECORDS;
+
+    private:
+        static_assert((CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two");
+        static_assert(CAPACITY % TELEMETRY_BLOCK_RECORDS == 0, "CAPACITY must be a whole number of blocks");
+
+        /* Aligned so every block handed to the SD card starts on a sector boundary. */
+        alignas(512) TelemetryRecord records[CAPACITY];
+
+        /* The number of records pushed and released so far. */
+        std::atomic<uint32_t> head;
+        std::atomic<uint32_t> tail;
+
+        /* Only written by the producer. */
+        std::atomic<uint32_t> dropped;
+
+    public:
+        TelemetryBuffer() : head(0), tail(0), dropped(0) {}
+
+        /**
+         * Adds a record to the queue (producer only). Never waits.
+         * @returns bool    Whether there was room for the record (if not, it
+         *                      was dropped and counted).
+        */
+        bool push(const TelemetryRecord &record);
+
+        /**
+         * Finds the records waiting to be written (consumer only). The
+         * records stay in the queue until release() is called.
+         * @param TelemetryRecord *&first   Set to the oldest waiting record.
+         * @returns uint32_t                How many waiting records come one
+         *                                      after another in memory from
+         *                                      `first` (at most up to the end
+         *                                      of the buffer).
+        */
+        uint32_t peek(const TelemetryRecord *&first);
+
+        /**
+         * Removes the oldest records from the queue (consumer only), making
+         * room for the producer.
+         * @param uint32_t count    How many records (at most what peek() returned).
+        */
+        void release(uint32_t count);
+
+        /** @returns uint32_t   The number of records waiting. */
+        uint32_t size() { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); }
+
+        /** @returns uint32_t   The number of records ever pushed (including dropped ones). */
+        uint32_t pushed() { return head.load(std::memory_order_acquire) + dropped.load(std::memory_order_relaxed); }
+
+        /** @returns uint32_t   The number of records dropped because the queue was full. */
+        uint32_t getDropped() { return dropped.load(std::memory_order_relaxed); }
+};
+
+/**
+ * Describes every field of TelemetryRecord, for the header of each log.
+*/
+extern const TelemetryChannel TELEMETRY_CHANNELS[];
+extern const int NUM_TELEMETRY_CHANNELS;
+
+/** The queue between the control loop and the telemetry task. */
+extern TelemetryBuffer telemetryBuffer;
+
+/**
+ * The name of the file the telemetry of this run is written to, made from
+ * TELEMETRY_FILE_FORMAT by startTelemetry() (telem000.bin, telem001.bin, ...).
+ * Empty if telemetry is off (no SD card).
+*/
+extern char telemetryFile[16];
+const char * const TELEMETRY_FILE_FORMAT = "telem%03d.bin";
+const int TELEMETRY_MAX_FILES = 1000;
+
+/**
+ * The battery voltage and motor temperatures are only read every this many
+ * records (they change over seconds, not ticks), to keep recording quick.
+*/
+const uint32_t TELEMETRY_SLOW_TICKS = 10;
+
+/**
+ * How often (in milliseconds) the telemetry task checks whether there is a
+ * full block to write.
+*/
+const int TELEMETRY_FLUSH_TIME = 100;
+
+/**
+ * Counts of what happened to the records, for the debug screen. Records that
+ * the SD card did not accept are counted as dropped too.
+*/
+struct TelemetryStats {
+    uint32_t recorded, written, droppedFull, droppedWrite;
+};
+
+/** @returns TelemetryStats     The counts so far. */
+TelemetryStats getTelemetryStats();
+
+/**
+ * Picks a new file on the SD card, writes the header (see telemetryFormat.h)
+ * and starts the low priority task that writes the recorded ticks to it. Does nothing (and records are not even
+ * made) if there is no SD card.
+*/
+void startTelemetry();
+
+/**
+ * Records the state of the controller, the wheels (and whether they started
+ * slipping) and the battery for one tick. Called once per tick by the control loop; only reads a few device
+ * values and copies one record, so it never waits for the SD card.
+ * @param InputFrame &input     The controller state used this tick (all zero
+ *                                  during autonomous).
+ * @param bool autonomous       Whether the tick is part of the autonomous period.
+*/
+void recordTelemetry(const InputFrame &input, bool autonomous);
+
+/**
+ * Writes every waiting record to the SD card, including a last partial block.
+ * Done by the telemetry task at the end of a match; only call it from
+ * elsewhere when the robot is done (the simulator does at the end of a run).
+*/
+void flushTelemetry();
+
+#endif
@@ -0,0 +1,98 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       telemetryFormat.h                                               */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Telemetry Log File Format                                       */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef TELEMETRY_FORMAT_HEADER_GUARD
+#define TELEMETRY_FORMAT_HEADER_GUARD
+
+#include <stdint.h>
+
+/**
+ * The layout of the telemetry logs (telemNNN.bin) on the SD card. Shared by
+ * the robot (telemetry.cpp) and the tools that read the logs on a computer
+ * (tools/telemetryStats.cpp), so it must not use anything from the SDK.
+ *
+ * A log is a TelemetryFileHeader, then `channelCount` TelemetryChannels, then
+ * zeros up to `headerSize`, then records of `recordSize` bytes until the end
+ * of the file. Everything is little endian (like the brain).
+ *
+ * The channels describe where each value is in a record, so a reader looks
+ * values up by name instead of depending on TelemetryRecord. Adding a value to
+ * the record (and a channel for it) does not break readers, and old logs can
+ * still be read by new readers. Only a change to the header or channel layout
+ * itself needs a new TELEMETRY_FORMAT_VERSION.
+*/
+
+/** "FHTL" (Firehawks telemetry log). */
+const char TELEMETRY_MAGIC[4] = {'F', 'H', 'T', 'L'};
+
+const uint16_t TELEMETRY_FORMAT_VERSION = 1;
+
+/**
+ * The size of the header with the channels and padding. A whole number of SD
+ * card sectors, so every block of records after it is sector aligned too.
+*/
+const uint16_t TELEMETRY_HEADER_SIZE = 1024;
+
+/** The types a channel can have. */
+enum telemetryTypes {
+    telemetryInt8 = 0,
+    telemetryUint8,
+    telemetryInt16,
+    telemetryUint16,
+    telemetryInt32,
+    telemetryUint32
+};
+
+struct TelemetryFileHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t headerSize;
+    uint16_t recordSize;
+    uint16_t channelCount;
+
+    /** The length of a control tick when the log was made, in microseconds. */
+    uint32_t tickLength;
+};
+
+struct TelemetryChannel {
+    /**
+     * Like "time" or "wheel0.velocity". Values of a wheel train start with
+     * "wheel" and the wheel train's index.
+    */
+    char name[24];
+
+    /** The units of the value once divided by `divisor` (like "rpm"). */
+    char units[8];
+
+    /** Where the value starts in a record, in bytes. */
+    uint16_t offset;
+
+    /** From `telemetryTypes`. */
+    uint8_t type;
+
+    uint8_t reserved;
+
+    /** What the raw value is divided by to get `units` (10 for tenths). */
+    uint32_t divisor;
+};
+
+static_assert(sizeof(TelemetryFileHeader) == 16, "TelemetryFileHeader is part of the file format");
+static_assert(sizeof(TelemetryChannel) == 40, "TelemetryChannel is part of the file format");
+
+/** @returns int    The size of a value of the type, in bytes (0 if unknown). */
+inline int telemetryTypeSize(uint8_t type) {
+    switch(type) {
+        case telemetryInt8: case telemetryUint8: return 1;
+        case telemetryInt16: case telemetryUint16: return 2;
+        case telemetryInt32: case telemetryUint32: return 4;
+        default: return 0;
+    }
+}
+
+#endif
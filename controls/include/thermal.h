@@ -0,0 +1,120 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       thermal.h                                                       */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Motor Temperature Tracking And Derating Declarations            */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef THERMAL_HEADER_GUARD
+#define THERMAL_HEADER_GUARD
+
+#include "vex.h"
+
+using namespace vex;
+
+/**
+ * The temperature (degrees C) at which a motor's firmware halves the current
+ * it may draw, with no warning. Above it the firmware halves it again every 5
+ * degrees.
+*/
+const double THROTTLE_TEMPERATURE = 55;
+
+/** The temperature (degrees C) at which we start taking current away ourselves. */
+const double DERATE_TEMPERATURE = 45;
+
+/**
+ * How much of its current a motor is left with at THROTTLE_TEMPERATURE. The
+ * same as the firmware's first cut, but reached a little at a time from
+ * DERATE_TEMPERATURE, so the driver can feel it coming. A motor heats up with
+ * the square of its current, so it usually settles somewhere below
+ * THROTTLE_TEMPERATURE instead of reaching it.
+*/
+const double MIN_THERMAL_POWER = 0.5;
+
+/** How often (in milliseconds) the motor temperatures are read. */
+const int THERMAL_SAMPLE_TIME = 2000;
+
+/**
+ * How far ahead (in seconds) the derating looks along the trend, so that a
+ * motor heating up quickly is derated a little before it gets hot instead of
+ * overshooting.
+*/
+const double THERMAL_LOOKAHEAD = 60;
+
+/**
+ * Follows one motor's temperature.
+ *
+ * Motors only report their temperature in steps (of 5 degrees C, rounded
+ * down), so a reading can stay the same for minutes while the motor heats up.
+ * The moment a reading changes is exact though: that is when the motor crossed
+ * a step. How quickly the motor is heating up comes from the time between the
+ * last two crossings, and its temperature from the last crossing along that
+ * rate.
+*/
+class ThermalTracker {
+    private:
+        bool started = false;
+        bool crossed = false;
+
+        /* The last reading, and how far apart the last two were. */
+        double reading = 0;
+        double step = 0;
+
+        /* The temperature the motor last crossed, and how many readings ago. */
+        double lastCrossing = 0;
+        int sinceCrossing = 0;
+
+        double temperature = 0;
+        double slope = 0;
+
+    public:
+        /**
+         * Adds a reading, taken THERMAL_SAMPLE_TIME after the last one.
+         * @param double celsius  The temperature the motor reported.
+        */
+        void add(double celsius);
+
+        /** @returns double   The motor's temperature (degrees C, between steps). */
+        double getTemperature() const { return temperature; }
+
+        /** @returns double   How quickly it is rising (degrees C per second). */
+        double getSlope() const { return slope; }
+
+        /**
+         * @returns double    How long until the motor reaches
+         *                        THROTTLE_TEMPERATURE at the rate it is
+         *                        heating up (seconds). 0 if it is already
+         *                        there, -1 if it is not heating up.
+        */
+        double secondsToThrottle() const;
+
+        /**
+         * @returns double    How much of its current the motor should be
+         *                        allowed (MIN_THERMAL_POWER to 1), from how hot
+         *                        it will be THERMAL_LOOKAHEAD from now.
+        */
+        double getPower() const;
+};
+
+/** One tracker per motor, in the same order as allMotors. */
+extern ThermalTracker motorThermals[NUM_MOTORS];
+
+/**
+ * Reads every motor's temperature every THERMAL_SAMPLE_TIME, and derates the
+ * motors that are getting hot by lowering how much current they may draw
+ * (see CachedMotor::setMaxTorque()):
+ *  - The drive gets the power of its hotter motor on both sides, so the robot
+ *        still drives straight (see drivePower()). Driving around takes
+ *        little current, so this mostly takes away pushing power.
+ *  - The intake and lift motors each get the power of the hotter one of their
+ *        pair.
+ * Called once per tick by the control loop, which owns the motors.
+*/
+void updateThermal();
+
+/** @returns double   The power the drive is allowed (MIN_THERMAL_POWER to 1). */
+double drivePower();
+
+#endif
@@ -0,0 +1,144 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       ticker.h                                                        */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Fixed Rate Tick Scheduler Declarations                          */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef TICKER_HEADER_GUARD
+#define TICKER_HEADER_GUARD
+
+#include "vex.h"
+#include <atomic>
+
+using namespace vex;
+
+/**
+ * Keeps a loop running at a constant rate.
+ *
+ * Calling `wait(TICK_LENGTH, msec)` at the end of a loop makes every tick last
+ * TICK_LENGTH PLUS however long the work in the loop took, so the loop runs
+ * slower than it should and the rate changes with the amount of work done.
+ * Instead, a Ticker sleeps until an absolute deadline (measured with the
+ * brain's timer), and every deadline is exactly one period after the last one.
+ *
+ * If the work in a tick takes longer than the period, then the deadlines that
+ * were missed are skipped (and counted as overruns) so that the loop keeps the
+ * same rhythm instead of rushing to catch up.
+ *
+ * Usage:
+ *      controlTicker.start();
+ *      while(1) {
+ *          //work
+ *          controlTicker.waitForNextTick();
+ *      }
+*/
+class Ticker {
+    private:
+        /* The time between deadlines, in microseconds. */
+        uint32_t period;
+
+        /* The time (from timer::systemHighResolution()) of the next deadline. */
+        uint64_t deadline = 0;
+
+        /* The time the last tick started. */
+        uint64_t lastTickStart = 0;
+
+        /* What the watchdog calls this ticker's loop (see watchdog.h), or nullptr if it is not watched. */
+        const char *name;
+
+        /* Whether the loop is between start() and stop(), and when its tick last started (low 32 bits), for the watchdog. */
+        std::atomic<bool> running;
+        std::atomic<uint32_t> checkedIn;
+
+        uint32_t ticks = 0;
+        uint32_t overruns = 0;
+        uint32_t lastPeriod = 0;
+        uint32_t lastWork = 0;
+        uint32_t lastJitter = 0;
+        uint32_t worstJitter = 0;
+
+    public:
+        /**
+         * @param int periodMs    The length of each tick, in milliseconds.
+         * @param char *name      If given, the watchdog (see watchdog.h)
+         *                            makes sure the loop starts a tick every
+         *                            period while it is running, and names
+         *                            the loop by this when it does not.
+        */
+        Ticker(int periodMs, const char *name = nullptr);
+
+        /**
+         * Starts the first tick now. Also clears the statistics.
+        */
+        void start();
+
+        /**
+         * Says the loop has finished (like at the end of an autonomous move),
+         * so the watchdog stops expecting ticks until start() is called again.
+         * Only needed for loops that end.
+        */
+        void stop();
+
+        /**
+         * Sleeps until the next deadline, then starts the next tick.
+        */
+        void waitForNextTick();
+
+        /** @returns const char *   The name the watchdog uses, or nullptr if not watched. */
+        const char *getName() { return name; }
+
+        /** @returns bool   Whether the loop is running (between start() and stop()). */
+        bool isRunning() { return running.load(std::memory_order_acquire); }
+
+        /**
+         * @returns uint32_t   When the current tick started (the low 32 bits of
+         *                         timer::systemHighResolution()). Safe to read
+         *                         from other tasks.
+        */
+        uint32_t getCheckIn() { return checkedIn.load(std::memory_order_acquire); }
+
+        /** @returns uint32_t   The length of each tick, in microseconds. */
+        uint32_t getPeriod() { return period; }
+
+        /** @returns uint32_t   The number of ticks since start(). */
+        uint32_t getTicks() { return ticks; }
+
+        /**
+         * @returns uint32_t   The number of deadlines that were missed because
+         *                         a tick took longer than the period.
+        */
+        uint32_t getOverruns() { return overruns; }
+
+        /** @returns uint32_t   How long the last tick actually took (µs). */
+        uint32_t getLastPeriod() { return lastPeriod; }
+
+        /**
+         * @returns uint32_t   How long the work in the last tick took (µs),
+         *                         from its start until waitForNextTick().
+        */
+        uint32_t getLastWork() { return lastWork; }
+
+        /**
+         * @returns uint64_t   When the current tick started
+         *                         (timer::systemHighResolution()), 0 before start().
+        */
+        uint64_t getTickStart() { return lastTickStart; }
+
+        /** @returns uint32_t   How late the last tick started (µs). */
+        uint32_t getLastJitter() { return lastJitter; }
+
+        /** @returns uint32_t   The latest any tick has started (µs). */
+        uint32_t getWorstJitter() { return worstJitter; }
+};
+
+/**
+ * The ticker for the driver control loop and the autonomous movements (only
+ * one of them runs at a time). Ticks every TICK_LENGTH milliseconds, watched
+ * by the watchdog as "control".
+*/
+extern Ticker controlTicker;
+
+#endif
@@ -0,0 +1,216 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       traction.h                                                      */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Wheel Slip Detection And Traction Control Declarations          */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef TRACTION_HEADER_GUARD
+#define TRACTION_HEADER_GUARD
+
+using namespace vex;
+
+/**
+ * How close (rpm) a slipping wheel has to come back to the speed of the floor
+ * under it (see TractionControl) before it grips again.
+*/
+const double SLIP_VELOCITY_MARGIN = 3;
+
+/**
+ * The most the floor can speed the wheels (and the robot) up or slow them
+ * down (rpm/s, about 0.27 g, a little under the 0.3 g of a clean field tile
+ * since the wheel overshoots a change of velocity). Without the inertial
+ * sensor, a wheel changing speed faster than this can only be spinning free
+ * (or locked up). It is also the most the velocity a wheel is given may
+ * change by (see TractionControl) until the floor has been found to give
+ * less.
+*/
+const double TRACTION_LIMIT = 500;
+
+/**
+ * How much faster (rpm/s) a wheel may speed up or slow down than the inertial
+ * sensor says the robot does before it looks like it is slipping.
+*/
+const double SLIP_ACCELERATION_MARGIN = 100;
+
+/**
+ * How many updates in a row (see WHEEL_CONTROL_PERIOD) a wheel has to look
+ * like it is slipping before it counts, so one noisy reading is not a slip.
+*/
+const int SLIP_CONFIRM_UPDATES = 2;
+
+/**
+ * Once a wheel slipped, its velocity only changes as fast as the robot was
+ * measured sliding (kinetic friction, which is less than what the floor
+ * gives before it breaks loose), times this. Without the inertial sensor it
+ * halves each slip instead. It never goes below MIN_TRACTION_LIMIT.
+*/
+const double TRACTION_RECOVERY = 0.9;
+const double MIN_TRACTION_LIMIT = 50;
+
+/**
+ * How quickly the limit found on a slip goes back up to TRACTION_LIMIT (part
+ * of the way left per second), for when the robot leaves a dusty tile. It
+ * only goes up while a wheel is being held to it without slipping, and
+ * slowly, since the next slip is what finds out it went too far.
+*/
+const double TRACTION_REGAIN = 0.01;
+
+/** The inertial sensor's axis that points to the front of the robot, and 1 or -1 for which way. */
+const axisType INERTIAL_FORWARD_AXIS = axisType::yaxis;
+const double INERTIAL_FORWARD_SIGN = 1;
+
+/** The inertial sensor's axis the robot turns about, and 1 or -1 so that turning clockwise is positive. */
+const axisType INERTIAL_TURN_AXIS = axisType::zaxis;
+const double INERTIAL_TURN_SIGN = 1;
+
+/**
+ * Whether a slipping wheel's velocity is held back (see TractionControl).
+ * Slips are still caught and counted without it. Only turned off to compare
+ * (like the simulator's traction benchmark).
+*/
+extern bool tractionControl;
+
+/**
+ * Catches one wheel slipping and keeps its velocity to what the floor can
+ * give.
+ *
+ * Run by Wheel::control() between the motion profile and the velocity
+ * controller (update()), then by checkTraction() to look for a slip (check()).
+ * A wheel counts as slipping when, for SLIP_CONFIRM_UPDATES updates in a row,
+ * it speeds up or slows down more than SLIP_ACCELERATION_MARGIN faster than
+ * the inertial sensor says the floor under it does (or faster than
+ * TRACTION_LIMIT, without the sensor). From the last update it gripped, the
+ * speed of the floor under it is followed with the sensor, and the slip is
+ * over once the wheel is back within SLIP_VELOCITY_MARGIN of it (or past
+ * it). That is when the floor catches the wheel again, so one slip is
+ * counted once however long it lasts.
+ *
+ * With tractionControl on:
+ *  - the velocity given to a slipping wheel is the floor's speed, so it
+ *        grips again as soon as it can, and
+ *  - the velocity given never changes faster than the floor gives, even when
+ *        the profile jumps, which is TRACTION_LIMIT until a slip says the
+ *        floor gives less (see TRACTION_RECOVERY and TRACTION_REGAIN).
+ *        Bringing the wheel back up to the profile's velocity after a slip,
+ *        the next time the driver asks for more than the floor gives, and
+ *        stopping (see canStop()) do not break it loose again.
+*/
+class TractionControl {
+    private:
+        /* The last measured velocity (rpm) and acceleration (rpm/s), and when. */
+        double lastMeasured = 0;
+        double acceleration = 0;
+        double dt = 0;
+        uint64_t lastTime = 0;
+
+        /* How fast the floor under the wheel is going (rpm), while it slips or looks like it might, and whether that is known yet. */
+        double floorVelocity = 0;
+        bool gripped = false;
+
+        /* How many updates in a row it has looked like it was slipping. */
+        int suspect = 0;
+
+        /*
+         * The velocity given to the velocity controller and how fast it is
+         * changing (rpm, rpm/s), whether it is being held to `limit`, and
+         * which way the wheel is off the floor while it slips.
+        */
+        bool started = false;
+        bool limiting = false;
+        double setpoint = 0;
+        double setpointAcceleration = 0;
+
+        /* The velocity update() last returned (rpm). */
+        double given = 0;
+        double direction = 0;
+
+        bool slipping = false;
+
+        /* The most the velocity given may change by (rpm/s, see TRACTION_RECOVERY). */
+        double limit = TRACTION_LIMIT;
+
+        uint32_t slips = 0;
+
+    public:
+        /**
+         * Measures the wheel and works out the velocity to give it. Called
+         * once every WHEEL_CONTROL_PERIOD.
+         * @param double velocity     The profile's velocity (rpm).
+         * @param double acceleration The profile's acceleration (rpm/s).
+         * @param double measured     The velocity the motor is going (rpm).
+         * @param uint64_t time       Now (timer::systemHighResolution()).
+         * @returns double            The velocity to give the velocity
+         *                                controller (rpm).
+        */
+        double update(double velocity, double acceleration, double measured, uint64_t time);
+
+        /**
+         * Checks the last update for a slip, starting or ending one. Called
+         * by checkTraction() straight after update().
+         * @param bool robotKnown         Whether the inertial sensor could be
+         *                                    read.
+         * @param double floor            How fast it says the robot's side
+         *                                    this wheel is on is speeding up
+         *                                    (rpm/s of the wheels).
+        */
+        void check(bool robotKnown, double floor);
+
+        /**
+         * @returns double    How fast the velocity update() last returned is
+         *                        changing (rpm/s), for the feedforward.
+        */
+        double getAcceleration() const { return setpointAcceleration; }
+
+        /** @returns double   How fast the wheel was measured speeding up (rpm/s). */
+        double getMeasuredAcceleration() const { return acceleration; }
+
+        /** @returns bool     Whether the wheel is slipping right now. */
+        bool isSlipping() const { return slipping; }
+
+        /**
+         * @returns bool   Whether the wheel can be braked to a stop straight
+         *                     away: it is not slipping and the velocity last
+         *                     given is within one update's change of 0 (or
+         *                     tractionControl is off).
+        */
+        bool canStop() const;
+
+        /** @returns double   The most the velocity given may change by right now (rpm/s). */
+        double getLimit() const { return limit; }
+
+        /** @returns uint32_t   How many times the wheel has started slipping. */
+        uint32_t getSlips() const { return slips; }
+
+        /** Forgets the last measurement and any slip (while the emergency stop is held). */
+        void reset();
+
+        /**
+         * Gives a velocity straight away, with no limit on the change (for
+         * stopping, see Wheel::setVelocity()).
+         * @param velocity   The velocity to give (rpm).
+        */
+        void jump(double velocity);
+
+        /** Forgets what the floor was found to give (like when the robot is put on another field). */
+        void forgetFloor() { limit = TRACTION_LIMIT; }
+};
+
+/**
+ * Reads the inertial sensor and has every wheel check its last update for a
+ * slip (see TractionControl::check()). Each wheel is compared with how fast
+ * the robot is speeding up, plus how much faster its own side is speeding up
+ * from how fast the robot's turning changes (so turning, where one side
+ * speeds up while the other slows down, does not look like a slip, and one
+ * wheel slipping does not make the other look like it is). Without the
+ * sensor (or while it calibrates) the wheels only check themselves against
+ * TRACTION_LIMIT.
+ *
+ * Called every WHEEL_CONTROL_PERIOD by the wheel control task, right after
+ * the wheels' controllers, so a slip is caught in the same update it shows.
+*/
+void checkTraction();
+
+#endif
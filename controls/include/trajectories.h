@@ -0,0 +1,102 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       trajectories.h                                                  */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Precomputed Autonomous Trajectory Declarations                  */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef TRAJECTORIES_HEADER_GUARD
+#define TRAJECTORIES_HEADER_GUARD
+
+#include "vex.h"
+#include "routes.h"
+
+using namespace vex;
+
+/**
+ * A trajectory is a route (see routes.h) worked out ahead of time: where the
+ * robot should be and how fast each side should be going, every
+ * TRAJECTORY_PERIOD. The tables are made on the computer by
+ * tools/trajectoryGen.cpp (run by `make -f sim.mk`) into trajectoryTables.h,
+ * so the brain does no planning at all, and they are const so they stay in
+ * flash instead of taking up memory. Each one is made twice, once mirrored
+ * for the left side, and only the one for SIDE is used.
+ *
+ * The tables have to be made again whenever a route changes (the build
+ * fails until they are, see trajectories.cpp).
+*/
+
+/** How far apart the samples are (ms). One per tick, since a tick is how often the wheels are updated. */
+const int TRAJECTORY_PERIOD = TICK_LENGTH;
+
+/** The fixed point scales of a TrajectorySample: positions in 1/32 inch, headings in 1/32 degree and velocities in 1/64 rpm. */
+const int TRAJECTORY_POSITION_SCALE = 32;
+const int TRAJECTORY_HEADING_SCALE = 32;
+const int TRAJECTORY_VELOCITY_SCALE = 64;
+
+/** The most flash a second of trajectory may take (bytes). */
+const int TRAJECTORY_BYTES_PER_SECOND_BUDGET = 256;
+
+/**
+ * How far ahead in the trajectory followTrajectory() takes the wheel
+ * velocities from (ms), because the wheels lag behind a change in velocity by
+ * about this much (see MotionProfile).
+*/
+const int TRAJECTORY_LEAD = 150;
+
+/** How hard followTrajectory() steers back onto the trajectory (rpm per inch to the side). */
+const double TRAJECTORY_SIDEWAYS_CORRECTION = 2.0;
+
+/** Where the robot should be, and how fast each side should go, at one moment (fixed point, see the scales above). */
+struct TrajectorySample {
+    int16_t x, y;
+    int16_t heading;
+    int16_t left, right;
+};
+
+/** The flash used by each second of trajectory (bytes). */
+constexpr int trajectoryBytesPerSecond() {
+    return sizeof(TrajectorySample) * 1000 / TRAJECTORY_PERIOD;
+}
+
+/** One trajectory: its samples, in order. */
+struct TrajectoryTable {
+    const TrajectorySample *samples;
+    int size;
+};
+
+/** The action behind followTrajectory(). */
+class FollowTrajectory : public DriveMove {
+    private:
+        const TrajectoryTable &trajectory;
+        uint32_t start = 0;
+
+    protected:
+        void startMove(const Pose &pose);
+        double drive(const Pose &pose);
+
+    public:
+        FollowTrajectory(const TrajectoryTable &trajectory, ExitConditions exit = PATH_EXIT)
+            : DriveMove(exit), trajectory(trajectory) {}
+};
+
+/**
+ * Drives along a precomputed trajectory, one sample every TRAJECTORY_PERIOD,
+ * steering back onto it if the robot gets pushed off. The robot should start
+ * where the trajectory does.
+ * @param const TrajectoryTable &trajectory   Where to go, and how fast.
+ * @param ExitConditions exit                 When the move is finished once
+ *                                                the trajectory has run out
+ *                                                (tolerance in inches from
+ *                                                the end).
+ * @returns bool                              Whether it got there before
+ *                                                the timeout.
+*/
+bool followTrajectory(const TrajectoryTable &trajectory, ExitConditions exit = PATH_EXIT);
+
+/** The HOME_ROW route (see routes.h), for SIDE. */
+extern const TrajectoryTable homeRowTrajectory;
+
+#endif
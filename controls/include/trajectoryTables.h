@@ -0,0 +1,629 @@
+/* Made by tools/trajectoryGen.cpp from routes.h (run `make -f sim.mk`), do not change by hand. See trajectories.h. */
+
+#ifndef TRAJECTORY_TABLES_HEADER_GUARD
+#define TRAJECTORY_TABLES_HEADER_GUARD
+
+#include "trajectories.h"
+
+/* HOME_ROW: 15.24 s, 131.7 in, 306 samples, 3060 bytes of flash. */
+constexpr uint64_t HOME_ROW_FINGERPRINT = 15961007781333975553ULL;
+
+constexpr TrajectorySample HOME_ROW_RIGHT[306] = {
+    {0, 0, 0, 0, 0},
+    {0, 1, -3, 231, 441},
+    {0, 4, -10, 465, 879},
+    {0, 8, -22, 705, 1311},
+    {0, 14, -39, 952, 1736},
+    {0, 22, -60, 1210, 2150},
+    {-1, 32, -84, 1481, 2551},
+    {-1, 43, -111, 1769, 2935},
+    {-2, 56, -139, 2011, 3200},
+    {-3, 70, -167, 2100, 3200},
+    {-5, 84, -192, 2194, 3200},
+    {-6, 98, -215, 2291, 3200},
+    {-8, 112, -236, 2393, 3200},
+    {-10, 127, -254, 2500, 3200},
+    {-12, 142, -269, 2612, 3200},
+    {-15, 157, -282, 2729, 3200},
+    {-17, 173, -292, 2853, 3200},
+    {-20, 188, -299, 2983, 3200},
+    {-22, 205, -302, 3122, 3200},
+    {-25, 221, -302, 3200, 3132},
+    {-28, 237, -299, 3200, 2992},
+    {-30, 253, -293, 3200, 2861},
+    {-33, 269, -283, 3200, 2737},
+    {-35, 284, -270, 3200, 2619},
+    {-37, 299, -255, 3200, 2507},
+    {-39, 313, -237, 3200, 2400},
+    {-41, 328, -217, 3200, 2298},
+    {-43, 342, -194, 3200, 2200},
+    {-44, 356, -169, 3200, 2106},
+    {-45, 370, -141, 3200, 2017},
+    {-46, 383, -112, 3200, 1931},
+    {-47, 396, -80, 3200, 1850},
+    {-47, 410, -47, 3200, 1772},
+    {-47, 422, -12, 3200, 1699},
+    {-47, 435, 25, 3200, 1631},
+    {-47, 448, 63, 3200, 1566},
+    {-46, 460, 103, 3200, 1507},
+    {-46, 472, 145, 3200, 1452},
+    {-45, 484, 187, 3200, 1401},
+    {-43, 496, 231, 3200, 1356},
+    {-42, 508, 276, 3200, 1316},
+    {-40, 520, 321, 3200, 1280},
+    {-37, 531, 368, 3200, 1250},
+    {-35, 543, 415, 3200, 1225},
+    {-32, 554, 462, 3200, 1205},
+    {-29, 565, 510, 3200, 1190},
+    {-26, 576, 559, 3200, 1181},
+    {-22, 587, 607, 3200, 1176},
+    {-19, 598, 656, 3200, 1176},
+    {-14, 608, 704, 3200, 1181},
+    {-10, 619, 753, 3200, 1190},
+    {-5, 629, 801, 3200, 1204},
+    {0, 640, 849, 3200, 1222},
+    {5, 651, 874, 3067, 2007},
+    {12, 663, 900, 3200, 2157},
+    {19, 675, 924, 3200, 2213},
+    {26, 688, 947, 3200, 2262},
+    {33, 700, 969, 3200, 2305},
+    {40, 713, 990, 3200, 2343},
+    {48, 725, 1010, 3200, 2376},
+    {55, 738, 1030, 3200, 2405},
+    {63, 750, 1048, 3200, 2431},
+    {71, 762, 1066, 3200, 2453},
+    {80, 775, 1084, 3200, 2472},
+    {88, 787, 1101, 3200, 2490},
+    {96, 799, 1118, 3200, 2504},
+    {105, 811, 1135, 3200, 2517},
+    {114, 824, 1151, 3200, 2528},
+    {123, 836, 1167, 3200, 2537},
+    {132, 848, 1183, 3200, 2545},
+    {141, 860, 1199, 3200, 2551},
+    {150, 872, 1214, 3200, 2556},
+    {159, 884, 1230, 3200, 2559},
+    {169, 895, 1245, 3200, 2561},
+    {178, 907, 1260, 3200, 2563},
+    {188, 919, 1275, 3200, 2563},
+    {198, 930, 1291, 3200, 2562},
+    {207, 942, 1306, 3200, 2560},
+    {217, 953, 1321, 3200, 2557},
+    {227, 964, 1337, 3200, 2553},
+    {237, 975, 1353, 3200, 2549},
+    {247, 987, 1368, 3200, 2543},
+    {258, 998, 1384, 3200, 2537},
+    {268, 1008, 1400, 3200, 2529},
+    {278, 1019, 1416, 3200, 2521},
+    {289, 1030, 1433, 3200, 2511},
+    {300, 1040, 1449, 3200, 2501},
+    {310, 1051, 1466, 3200, 2490},
+    {321, 1061, 1483, 3200, 2478},
+    {332, 1071, 1501, 3200, 2465},
+    {343, 1081, 1519, 3200, 2451},
+    {353, 1091, 1537, 3200, 2436},
+    {364, 1101, 1555, 3200, 2420},
+    {376, 1111, 1574, 3200, 2403},
+    {387, 1120, 1594, 3200, 2384},
+    {398, 1130, 1614, 3200, 2365},
+    {409, 1139, 1634, 3200, 2344},
+    {420, 1148, 1655, 3200, 2322},
+    {432, 1157, 1676, 3200, 2299},
+    {443, 1166, 1698, 3200, 2275},
+    {455, 1174, 1720, 3200, 2249},
+    {466, 1182, 1743, 3200, 2222},
+    {478, 1191, 1767, 3200, 2194},
+    {489, 1199, 1792, 3200, 2164},
+    {501, 1206, 1817, 3200, 2132},
+    {513, 1214, 1843, 3200, 2100},
+    {525, 1221, 1870, 3200, 2065},
+    {536, 1228, 1898, 3200, 2029},
+    {548, 1235, 1926, 3200, 1992},
+    {560, 1242, 1956, 3200, 1952},
+    {572, 1248, 1986, 3200, 1912},
+    {584, 1254, 2017, 3200, 1869},
+    {595, 1260, 2050, 3200, 1826},
+    {607, 1266, 2083, 3200, 1780},
+    {619, 1271, 2118, 3200, 1734},
+    {631, 1276, 2154, 3200, 1686},
+    {643, 1281, 2190, 3200, 1780},
+    {655, 1286, 2223, 3200, 1831},
+    {667, 1290, 2256, 3200, 1879},
+    {680, 1295, 2287, 3200, 1926},
+    {693, 1299, 2317, 3200, 1970},
+    {706, 1303, 2346, 3200, 2012},
+    {719, 1307, 2374, 3200, 2053},
+    {732, 1310, 2401, 3200, 2091},
+    {746, 1314, 2427, 3200, 2127},
+    {759, 1317, 2452, 3200, 2162},
+    {773, 1320, 2477, 3200, 2194},
+    {787, 1323, 2501, 3200, 2225},
+    {801, 1326, 2524, 3200, 2254},
+    {815, 1329, 2546, 3200, 2282},
+    {829, 1331, 2568, 3200, 2308},
+    {843, 1334, 2589, 3200, 2333},
+    {858, 1336, 2610, 3200, 2356},
+    {872, 1338, 2630, 3200, 2378},
+    {887, 1340, 2649, 3200, 2398},
+    {901, 1342, 2668, 3200, 2417},
+    {916, 1343, 2687, 3200, 2435},
+    {930, 1345, 2705, 3200, 2452},
+    {945, 1346, 2722, 3200, 2468},
+    {960, 1347, 2740, 3200, 2483},
+    {975, 1348, 2757, 3200, 2497},
+    {990, 1349, 2774, 3200, 2509},
+    {1005, 1350, 2790, 3200, 2521},
+    {1020, 1351, 2806, 3200, 2532},
+    {1035, 1351, 2822, 3200, 2542},
+    {1050, 1352, 2838, 3200, 2552},
+    {1065, 1352, 2853, 3200, 2560},
+    {1080, 1352, 2869, 3200, 2568},
+    {1095, 1352, 2884, 3200, 2575},
+    {1110, 1352, 2899, 3200, 2581},
+    {1125, 1352, 2913, 3200, 2586},
+    {1140, 1352, 2928, 3200, 2590},
+    {1156, 1351, 2943, 3200, 2594},
+    {1171, 1351, 2957, 3200, 2597},
+    {1186, 1350, 2972, 3200, 2600},
+    {1201, 1349, 2986, 3200, 2601},
+    {1216, 1348, 3000, 3200, 2602},
+    {1231, 1347, 3015, 3200, 2602},
+    {1247, 1346, 3029, 3200, 2601},
+    {1262, 1345, 3043, 3200, 2600},
+    {1277, 1343, 3058, 3200, 2597},
+    {1292, 1342, 3072, 3200, 2594},
+    {1307, 1340, 3087, 3200, 2590},
+    {1322, 1338, 3102, 3200, 2585},
+    {1337, 1336, 3116, 3200, 2579},
+    {1352, 1334, 3131, 3200, 2572},
+    {1367, 1332, 3147, 3200, 2564},
+    {1382, 1330, 3162, 3200, 2555},
+    {1397, 1328, 3178, 3200, 2545},
+    {1412, 1325, 3193, 3200, 2533},
+    {1426, 1322, 3210, 3200, 2520},
+    {1441, 1320, 3226, 3200, 2506},
+    {1456, 1317, 3243, 3200, 2489},
+    {1470, 1314, 3260, 3200, 2472},
+    {1485, 1311, 3278, 3200, 2452},
+    {1499, 1308, 3296, 3200, 2430},
+    {1513, 1304, 3315, 3200, 2407},
+    {1528, 1301, 3334, 3200, 2380},
+    {1542, 1297, 3354, 3200, 2351},
+    {1556, 1293, 3375, 3200, 2320},
+    {1570, 1289, 3396, 3200, 2285},
+    {1583, 1285, 3419, 3095, 2173},
+    {1596, 1281, 3440, 2719, 1876},
+    {1606, 1278, 3478, 3200, 1115},
+    {1617, 1274, 3528, 3200, 1136},
+    {1628, 1270, 3577, 3200, 1161},
+    {1638, 1266, 3626, 3200, 1190},
+    {1649, 1261, 3674, 3200, 1224},
+    {1659, 1256, 3721, 3200, 1262},
+    {1670, 1251, 3767, 3200, 1304},
+    {1680, 1245, 3812, 3200, 1349},
+    {1691, 1239, 3855, 3200, 1398},
+    {1701, 1233, 3898, 3200, 1451},
+    {1711, 1226, 3939, 3200, 1507},
+    {1722, 1219, 3979, 3200, 1565},
+    {1732, 1212, 4018, 3200, 1626},
+    {1742, 1205, 4055, 3200, 1690},
+    {1752, 1197, 4090, 3200, 1756},
+    {1763, 1189, 4124, 3200, 1823},
+    {1773, 1180, 4156, 3200, 1893},
+    {1783, 1172, 4187, 3200, 1964},
+    {1793, 1163, 4216, 3200, 2037},
+    {1804, 1153, 4243, 3200, 2111},
+    {1814, 1144, 4268, 3200, 2186},
+    {1824, 1134, 4291, 3200, 2263},
+    {1834, 1124, 4313, 3200, 2341},
+    {1845, 1114, 4333, 3200, 2420},
+    {1855, 1103, 4350, 3200, 2501},
+    {1866, 1092, 4366, 3200, 2584},
+    {1876, 1081, 4380, 3200, 2668},
+    {1887, 1070, 4392, 3200, 2755},
+    {1897, 1058, 4401, 3200, 2844},
+    {1908, 1046, 4409, 3200, 2937},
+    {1919, 1034, 4414, 3200, 3034},
+    {1930, 1022, 4417, 3200, 3135},
+    {1941, 1010, 4417, 3158, 3200},
+    {1952, 997, 4415, 3054, 3200},
+    {1963, 985, 4410, 2954, 3200},
+    {1974, 974, 4403, 2856, 3200},
+    {1984, 962, 4394, 2760, 3200},
+    {1995, 951, 4382, 2667, 3200},
+    {2005, 939, 4368, 2574, 3200},
+    {2016, 929, 4352, 2483, 3200},
+    {2026, 918, 4334, 2393, 3200},
+    {2036, 908, 4313, 2304, 3200},
+    {2046, 898, 4291, 2215, 3200},
+    {2057, 888, 4266, 2127, 3200},
+    {2067, 879, 4239, 2040, 3200},
+    {2077, 870, 4210, 1954, 3200},
+    {2087, 861, 4179, 1869, 3200},
+    {2097, 852, 4146, 1786, 3200},
+    {2107, 844, 4111, 1703, 3200},
+    {2117, 836, 4074, 1623, 3200},
+    {2127, 829, 4036, 1545, 3200},
+    {2137, 822, 3995, 1469, 3200},
+    {2147, 815, 3953, 1397, 3200},
+    {2157, 808, 3909, 1327, 3200},
+    {2167, 802, 3863, 1261, 3200},
+    {2177, 796, 3815, 1199, 3200},
+    {2187, 791, 3767, 1141, 3200},
+    {2197, 786, 3717, 1087, 3200},
+    {2207, 781, 3665, 1039, 3200},
+    {2218, 777, 3613, 995, 3200},
+    {2228, 773, 3560, 957, 3200},
+    {2238, 769, 3505, 925, 3200},
+    {2249, 765, 3464, 1503, 3145},
+    {2260, 761, 3425, 1563, 3200},
+    {2272, 758, 3386, 1600, 3200},
+    {2285, 754, 3348, 1638, 3200},
+    {2297, 751, 3311, 1678, 3200},
+    {2309, 749, 3275, 1719, 3200},
+    {2322, 746, 3240, 1762, 3200},
+    {2335, 743, 3206, 1805, 3200},
+    {2348, 741, 3173, 1850, 3200},
+    {2361, 739, 3141, 1896, 3200},
+    {2374, 737, 3110, 1942, 3200},
+    {2388, 736, 3080, 1988, 3200},
+    {2401, 735, 3052, 2035, 3200},
+    {2415, 733, 3025, 2083, 3200},
+    {2429, 732, 2998, 2130, 3200},
+    {2443, 732, 2973, 2177, 3200},
+    {2457, 731, 2949, 2225, 3200},
+    {2471, 730, 2926, 2272, 3200},
+    {2486, 730, 2905, 2319, 3200},
+    {2500, 730, 2884, 2366, 3200},
+    {2515, 730, 2865, 2412, 3200},
+    {2529, 730, 2846, 2458, 3200},
+    {2544, 731, 2829, 2504, 3200},
+    {2559, 731, 2813, 2550, 3200},
+    {2574, 732, 2798, 2595, 3200},
+    {2590, 733, 2784, 2640, 3200},
+    {2605, 733, 2771, 2684, 3200},
+    {2620, 734, 2759, 2729, 3200},
+    {2636, 735, 2748, 2773, 3200},
+    {2652, 737, 2739, 2818, 3200},
+    {2667, 738, 2730, 2862, 3200},
+    {2683, 739, 2722, 2906, 3200},
+    {2699, 741, 2716, 2951, 3200},
+    {2715, 742, 2710, 2996, 3200},
+    {2732, 744, 2706, 3041, 3200},
+    {2748, 745, 2703, 3087, 3200},
+    {2764, 747, 2701, 3133, 3200},
+    {2781, 748, 2700, 3181, 3200},
+    {2798, 750, 2700, 3200, 3171},
+    {2814, 752, 2701, 3200, 3124},
+    {2830, 753, 2703, 3200, 3078},
+    {2847, 755, 2707, 3200, 3032},
+    {2863, 756, 2711, 3200, 2987},
+    {2879, 758, 2717, 3200, 2942},
+    {2895, 759, 2724, 3200, 2898},
+    {2911, 760, 2732, 3200, 2853},
+    {2927, 762, 2740, 3200, 2809},
+    {2942, 763, 2750, 3200, 2765},
+    {2958, 764, 2761, 3200, 2720},
+    {2973, 765, 2773, 3200, 2676},
+    {2988, 766, 2786, 3200, 2631},
+    {3004, 766, 2801, 3200, 2586},
+    {3018, 767, 2815, 2929, 2327},
+    {3031, 767, 2829, 2572, 2012},
+    {3042, 768, 2842, 2208, 1703},
+    {3052, 768, 2854, 1838, 1401},
+    {3059, 768, 2863, 1463, 1104},
+    {3065, 768, 2871, 1084, 812},
+    {3069, 768, 2876, 701, 522},
+    {3071, 768, 2879, 316, 235},
+    {3072, 768, 2880, 0, 0},
+};
+
+constexpr TrajectorySample HOME_ROW_LEFT[306] = {
+    {0, 0, 0, 0, 0},
+    {0, 1, 3, 441, 231},
+    {0, 4, 10, 879, 465},
+    {0, 8, 22, 1311, 705},
+    {0, 14, 39, 1736, 952},
+    {0, 22, 60, 2150, 1210},
+    {1, 32, 84, 2551, 1481},
+    {1, 43, 111, 2935, 1769},
+    {2, 56, 139, 3200, 2011},
+    {3, 70, 167, 3200, 2100},
+    {5, 84, 192, 3200, 2194},
+    {6, 98, 215, 3200, 2291},
+    {8, 112, 236, 3200, 2393},
+    {10, 127, 254, 3200, 2500},
+    {12, 142, 269, 3200, 2612},
+    {15, 157, 282, 3200, 2729},
+    {17, 173, 292, 3200, 2853},
+    {20, 188, 299, 3200, 2983},
+    {22, 205, 302, 3200, 3122},
+    {25, 221, 302, 3132, 3200},
+    {28, 237, 299, 2992, 3200},
+    {30, 253, 293, 2861, 3200},
+    {33, 269, 283, 2737, 3200},
+    {35, 284, 270, 2619, 3200},
+    {37, 299, 255, 2507, 3200},
+    {39, 313, 237, 2400, 3200},
+    {41, 328, 217, 2298, 3200},
+    {43, 342, 194, 2200, 3200},
+    {44, 356, 169, 2106, 3200},
+    {45, 370, 141, 2017, 3200},
+    {46, 383, 112, 1931, 3200},
+    {47, 396, 80, 1850, 3200},
+    {47, 410, 47, 1772, 3200},
+    {47, 422, 12, 1699, 3200},
+    {47, 435, -25, 1631, 3200},
+    {47, 448, -63, 1566, 3200},
+    {46, 460, -103, 1507, 3200},
+    {46, 472, -145, 1452, 3200},
+    {45, 484, -187, 1401, 3200},
+    {43, 496, -231, 1356, 3200},
+    {42, 508, -276, 1316, 3200},
+    {40, 520, -321, 1280, 3200},
+    {37, 531, -368, 1250, 3200},
+    {35, 543, -415, 1225, 3200},
+    {32, 554, -462, 1205, 3200},
+    {29, 565, -510, 1190, 3200},
+    {26, 576, -559, 1181, 3200},
+    {22, 587, -607, 1176, 3200},
+    {19, 598, -656, 1176, 3200},
+    {14, 608, -704, 1181, 3200},
+    {10, 619, -753, 1190, 3200},
+    {5, 629, -801, 1204, 3200},
+    {0, 640, -849, 1222, 3200},
+    {-5, 651, -874, 2007, 3067},
+    {-12, 663, -900, 2157, 3200},
+    {-19, 675, -924, 2213, 3200},
+    {-26, 688, -947, 2262, 3200},
+    {-33, 700, -969, 2305, 3200},
+    {-40, 713, -990, 2343, 3200},
+    {-48, 725, -1010, 2376, 3200},
+    {-55, 738, -1030, 2405, 3200},
+    {-63, 750, -1048, 2431, 3200},
+    {-71, 762, -1066, 2453, 3200},
+    {-80, 775, -1084, 2472, 3200},
+    {-88, 787, -1101, 2490, 3200},
+    {-96, 799, -1118, 2504, 3200},
+    {-105, 811, -1135, 2517, 3200},
+    {-114, 824, -1151, 2528, 3200},
+    {-123, 836, -1167, 2537, 3200},
+    {-132, 848, -1183, 2545, 3200},
+    {-141, 860, -1199, 2551, 3200},
+    {-150, 872, -1214, 2556, 3200},
+    {-159, 884, -1230, 2559, 3200},
+    {-169, 895, -1245, 2561, 3200},
+    {-178, 907, -1260, 2563, 3200},
+    {-188, 919, -1275, 2563, 3200},
+    {-198, 930, -1291, 2562, 3200},
+    {-207, 942, -1306, 2560, 3200},
+    {-217, 953, -1321, 2557, 3200},
+    {-227, 964, -1337, 2553, 3200},
+    {-237, 975, -1353, 2549, 3200},
+    {-247, 987, -1368, 2543, 3200},
+    {-258, 998, -1384, 2537, 3200},
+    {-268, 1008, -1400, 2529, 3200},
+    {-278, 1019, -1416, 2521, 3200},
+    {-289, 1030, -1433, 2511, 3200},
+    {-300, 1040, -1449, 2501, 3200},
+    {-310, 1051, -1466, 2490, 3200},
+    {-321, 1061, -1483, 2478, 3200},
+    {-332, 1071, -1501, 2465, 3200},
+    {-343, 1081, -1519, 2451, 3200},
+    {-353, 1091, -1537, 2436, 3200},
+    {-364, 1101, -1555, 2420, 3200},
+    {-376, 1111, -1574, 2403, 3200},
+    {-387, 1120, -1594, 2384, 3200},
+    {-398, 1130, -1614, 2365, 3200},
+    {-409, 1139, -1634, 2344, 3200},
+    {-420, 1148, -1655, 2322, 3200},
+    {-432, 1157, -1676, 2299, 3200},
+    {-443, 1166, -1698, 2275, 3200},
+    {-455, 1174, -1720, 2249, 3200},
+    {-466, 1182, -1743, 2222, 3200},
+    {-478, 1191, -1767, 2194, 3200},
+    {-489, 1199, -1792, 2164, 3200},
+    {-501, 1206, -1817, 2132, 3200},
+    {-513, 1214, -1843, 2100, 3200},
+    {-525, 1221, -1870, 2065, 3200},
+    {-536, 1228, -1898, 2029, 3200},
+    {-548, 1235, -1926, 1992, 3200},
+    {-560, 1242, -1956, 1952, 3200},
+    {-572, 1248, -1986, 1912, 3200},
+    {-584, 1254, -2017, 1869, 3200},
+    {-595, 1260, -2050, 1826, 3200},
+    {-607, 1266, -2083, 1780, 3200},
+    {-619, 1271, -2118, 1734, 3200},
+    {-631, 1276, -2154, 1686, 3200},
+    {-643, 1281, -2190, 1780, 3200},
+    {-655, 1286, -2223, 1831, 3200},
+    {-667, 1290, -2256, 1879, 3200},
+    {-680, 1295, -2287, 1926, 3200},
+    {-693, 1299, -2317, 1970, 3200},
+    {-706, 1303, -2346, 2012, 3200},
+    {-719, 1307, -2374, 2053, 3200},
+    {-732, 1310, -2401, 2091, 3200},
+    {-746, 1314, -2427, 2127, 3200},
+    {-759, 1317, -2452, 2162, 3200},
+    {-773, 1320, -2477, 2194, 3200},
+    {-787, 1323, -2501, 2225, 3200},
+    {-801, 1326, -2524, 2254, 3200},
+    {-815, 1329, -2546, 2282, 3200},
+    {-829, 1331, -2568, 2308, 3200},
+    {-843, 1334, -2589, 2333, 3200},
+    {-858, 1336, -2610, 2356, 3200},
+    {-872, 1338, -2630, 2378, 3200},
+    {-887, 1340, -2649, 2398, 3200},
+    {-901, 1342, -2668, 2417, 3200},
+    {-916, 1343, -2687, 2435, 3200},
+    {-930, 1345, -2705, 2452, 3200},
+    {-945, 1346, -2722, 2468, 3200},
+    {-960, 1347, -2740, 2483, 3200},
+    {-975, 1348, -2757, 2497, 3200},
+    {-990, 1349, -2774, 2509, 3200},
+    {-1005, 1350, -2790, 2521, 3200},
+    {-1020, 1351, -2806, 2532, 3200},
+    {-1035, 1351, -2822, 2542, 3200},
+    {-1050, 1352, -2838, 2552, 3200},
+    {-1065, 1352, -2853, 2560, 3200},
+    {-1080, 1352, -2869, 2568, 3200},
+    {-1095, 1352, -2884, 2575, 3200},
+    {-1110, 1352, -2899, 2581, 3200},
+    {-1125, 1352, -2913, 2586, 3200},
+    {-1140, 1352, -2928, 2590, 3200},
+    {-1156, 1351, -2943, 2594, 3200},
+    {-1171, 1351, -2957, 2597, 3200},
+    {-1186, 1350, -2972, 2600, 3200},
+    {-1201, 1349, -2986, 2601, 3200},
+    {-1216, 1348, -3000, 2602, 3200},
+    {-1231, 1347, -3015, 2602, 3200},
+    {-1247, 1346, -3029, 2601, 3200},
+    {-1262, 1345, -3043, 2600, 3200},
+    {-1277, 1343, -3058, 2597, 3200},
+    {-1292, 1342, -3072, 2594, 3200},
+    {-1307, 1340, -3087, 2590, 3200},
+    {-1322, 1338, -3102, 2585, 3200},
+    {-1337, 1336, -3116, 2579, 3200},
+    {-1352, 1334, -3131, 2572, 3200},
+    {-1367, 1332, -3147, 2564, 3200},
+    {-1382, 1330, -3162, 2555, 3200},
+    {-1397, 1328, -3178, 2545, 3200},
+    {-1412, 1325, -3193, 2533, 3200},
+    {-1426, 1322, -3210, 2520, 3200},
+    {-1441, 1320, -3226, 2506, 3200},
+    {-1456, 1317, -3243, 2489, 3200},
+    {-1470, 1314, -3260, 2472, 3200},
+    {-1485, 1311, -3278, 2452, 3200},
+    {-1499, 1308, -3296, 2430, 3200},
+    {-1513, 1304, -3315, 2407, 3200},
+    {-1528, 1301, -3334, 2380, 3200},
+    {-1542, 1297, -3354, 2351, 3200},
+    {-1556, 1293, -3375, 2320, 3200},
+    {-1570, 1289, -3396, 2285, 3200},
+    {-1583, 1285, -3419, 2173, 3095},
+    {-1596, 1281, -3440, 1876, 2719},
+    {-1606, 1278, -3478, 1115, 3200},
+    {-1617, 1274, -3528, 1136, 3200},
+    {-1628, 1270, -3577, 1161, 3200},
+    {-1638, 1266, -3626, 1190, 3200},
+    {-1649, 1261, -3674, 1224, 3200},
+    {-1659, 1256, -3721, 1262, 3200},
+    {-1670, 1251, -3767, 1304, 3200},
+    {-1680, 1245, -3812, 1349, 3200},
+    {-1691, 1239, -3855, 1398, 3200},
+    {-1701, 1233, -3898, 1451, 3200},
+    {-1711, 1226, -3939, 1507, 3200},
+    {-1722, 1219, -3979, 1565, 3200},
+    {-1732, 1212, -4018, 1626, 3200},
+    {-1742, 1205, -4055, 1690, 3200},
+    {-1752, 1197, -4090, 1756, 3200},
+    {-1763, 1189, -4124, 1823, 3200},
+    {-1773, 1180, -4156, 1893, 3200},
+    {-1783, 1172, -4187, 1964, 3200},
+    {-1793, 1163, -4216, 2037, 3200},
+    {-1804, 1153, -4243, 2111, 3200},
+    {-1814, 1144, -4268, 2186, 3200},
+    {-1824, 1134, -4291, 2263, 3200},
+    {-1834, 1124, -4313, 2341, 3200},
+    {-1845, 1114, -4333, 2420, 3200},
+    {-1855, 1103, -4350, 2501, 3200},
+    {-1866, 1092, -4366, 2584, 3200},
+    {-1876, 1081, -4380, 2668, 3200},
+    {-1887, 1070, -4392, 2755, 3200},
+    {-1897, 1058, -4401, 2844, 3200},
+    {-1908, 1046, -4409, 2937, 3200},
+    {-1919, 1034, -4414, 3034, 3200},
+    {-1930, 1022, -4417, 3135, 3200},
+    {-1941, 1010, -4417, 3200, 3158},
+    {-1952, 997, -4415, 3200, 3054},
+    {-1963, 985, -4410, 3200, 2954},
+    {-1974, 974, -4403, 3200, 2856},
+    {-1984, 962, -4394, 3200, 2760},
+    {-1995, 951, -4382, 3200, 2667},
+    {-2005, 939, -4368, 3200, 2574},
+    {-2016, 929, -4352, 3200, 2483},
+    {-2026, 918, -4334, 3200, 2393},
+    {-2036, 908, -4313, 3200, 2304},
+    {-2046, 898, -4291, 3200, 2215},
+    {-2057, 888, -4266, 3200, 2127},
+    {-2067, 879, -4239, 3200, 2040},
+    {-2077, 870, -4210, 3200, 1954},
+    {-2087, 861, -4179, 3200, 1869},
+    {-2097, 852, -4146, 3200, 1786},
+    {-2107, 844, -4111, 3200, 1703},
+    {-2117, 836, -4074, 3200, 1623},
+    {-2127, 829, -4036, 3200, 1545},
+    {-2137, 822, -3995, 3200, 1469},
+    {-2147, 815, -3953, 3200, 1397},
+    {-2157, 808, -3909, 3200, 1327},
+    {-2167, 802, -3863, 3200, 1261},
+    {-2177, 796, -3815, 3200, 1199},
+    {-2187, 791, -3767, 3200, 1141},
+    {-2197, 786, -3717, 3200, 1087},
+    {-2207, 781, -3665, 3200, 1039},
+    {-2218, 777, -3613, 3200, 995},
+    {-2228, 773, -3560, 3200, 957},
+    {-2238, 769, -3505, 3200, 925},
+    {-2249, 765, -3464, 3145, 1503},
+    {-2260, 761, -3425, 3200, 1563},
+    {-2272, 758, -3386, 3200, 1600},
+    {-2285, 754, -3348, 3200, 1638},
+    {-2297, 751, -3311, 3200, 1678},
+    {-2309, 749, -3275, 3200, 1719},
+    {-2322, 746, -3240, 3200, 1762},
+    {-2335, 743, -3206, 3200, 1805},
+    {-2348, 741, -3173, 3200, 1850},
+    {-2361, 739, -3141, 3200, 1896},
+    {-2374, 737, -3110, 3200, 1942},
+    {-2388, 736, -3080, 3200, 1988},
+    {-2401, 735, -3052, 3200, 2035},
+    {-2415, 733, -3025, 3200, 2083},
+    {-2429, 732, -2998, 3200, 2130},
+    {-2443, 732, -2973, 3200, 2177},
+    {-2457, 731, -2949, 3200, 2225},
+    {-2471, 730, -2926, 3200, 2272},
+    {-2486, 730, -2905, 3200, 2319},
+    {-2500, 730, -2884, 3200, 2366},
+    {-2515, 730, -2865, 3200, 2412},
+    {-2529, 730, -2846, 3200, 2458},
+    {-2544, 731, -2829, 3200, 2504},
+    {-2559, 731, -2813, 3200, 2550},
+    {-2574, 732, -2798, 3200, 2595},
+    {-2590, 733, -2784, 3200, 2640},
+    {-2605, 733, -2771, 3200, 2684},
+    {-2620, 734, -2759, 3200, 2729},
+    {-2636, 735, -2748, 3200, 2773},
+    {-2652, 737, -2739, 3200, 2818},
+    {-2667, 738, -2730, 3200, 2862},
+    {-2683, 739, -2722, 3200, 2906},
+    {-2699, 741, -2716, 3200, 2951},
+    {-2715, 742, -2710, 3200, 2996},
+    {-2732, 744, -2706, 3200, 3041},
+    {-2748, 745, -2703, 3200, 3087},
+    {-2764, 747, -2701, 3200, 3133},
+    {-2781, 748, -2700, 3200, 3181},
+    {-2798, 750, -2700, 3171, 3200},
+    {-2814, 752, -2701, 3124, 3200},
+    {-2830, 753, -2703, 3078, 3200},
+    {-2847, 755, -2707, 3032, 3200},
+    {-2863, 756, -2711, 2987, 3200},
+    {-2879, 758, -2717, 2942, 3200},
+    {-2895, 759, -2724, 2898, 3200},
+    {-2911, 760, -2732, 2853, 3200},
+    {-2927, 762, -2740, 2809, 3200},
+    {-2942, 763, -2750, 2765, 3200},
+    {-2958, 764, -2761, 2720, 3200},
+    {-2973, 765, -2773, 2676, 3200},
+    {-2988, 766, -2786, 2631, 3200},
+    {-3004, 766, -2801, 2586, 3200},
+    {-3018, 767, -2815, 2327, 2929},
+    {-3031, 767, -2829, 2012, 2572},
+    {-3042, 768, -2842, 1703, 2208},
+    {-3052, 768, -2854, 1401, 1838},
+    {-3059, 768, -2863, 1104, 1463},
+    {-3065, 768, -2871, 812, 1084},
+    {-3069, 768, -2876, 522, 701},
+    {-3071, 768, -2879, 235, 316},
+    {-3072, 768, -2880, 0, 0},
+};
+
+#endif
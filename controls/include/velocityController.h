@@ -0,0 +1,116 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       velocityController.h                                            */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Closed-Loop Wheel Velocity Controller Declarations              */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef VELOCITY_CONTROLLER_HEADER_GUARD
+#define VELOCITY_CONTROLLER_HEADER_GUARD
+
+using namespace vex;
+
+/**
+ * How often (in milliseconds) the wheel velocity controllers run. Five times
+ * as often as the control tick, so a wheel that falls behind is caught long
+ * before the driver would notice the robot curving.
+*/
+const int WHEEL_CONTROL_PERIOD = 10;
+
+/** The most voltage a motor can be given (volts). */
+const double MAX_MOTOR_VOLTAGE = 12.0;
+
+/**
+ * The gains of a velocity controller. The output is a voltage:
+ *
+ *     kS * sign(setpoint) + kV * setpoint + kA * acceleration   (feedforward)
+ *   + kP * error + kI * integral(error) - kD * d(measured)/dt
+ *
+ * The feedforward is the voltage that should give the setpoint on its own
+ * (kV is 12 V divided by the free speed, kS is what it takes to get the
+ * wheels moving at all, and kA is the extra it takes to speed the robot up
+ * as fast as the motion profile asks). The PID part only makes up what the feedforward
+ * gets wrong, like one side of the drive having more friction.
+*/
+struct VelocityGains {
+    /** Volts to overcome friction. */
+    double kS;
+    /** Volts per rpm. */
+    double kV;
+    /** Volts per rpm/s of acceleration. */
+    double kA;
+    /** Volts per rpm of error. */
+    double kP;
+    /** Volts per rpm of error per second. */
+    double kI;
+    /** Volts per rpm/s change in the measured velocity. */
+    double kD;
+    /** The most the integral may add or take away (volts), so it can't wind up. */
+    double maxIntegral;
+};
+
+/** The gains for both wheel trains (36:1 motors, 100 rpm free speed). */
+const VelocityGains WHEEL_GAINS = {0.3, 0.12, 0.012, 0.05, 0.8, 0.0, 2.0};
+
+/**
+ * Feedforward plus PID on the measured velocity, working out the voltage that
+ * keeps a motor at a velocity.
+ *
+ * Anti-windup: the integral is clamped to maxIntegral, and it stops growing
+ * while the output is already at its limit (see setMaxVoltage()) in the
+ * direction it would grow (when the motor simply can't go faster, like when pushing against a
+ * wall). The derivative is on the measured velocity rather than the error, so
+ * a change of setpoint does not kick the output.
+*/
+class VelocityController {
+    private:
+        VelocityGains gains;
+
+        double integral = 0;
+        double maxVoltage = MAX_MOTOR_VOLTAGE;
+        double lastMeasured = 0;
+        uint64_t lastTime = 0;
+
+    public:
+        VelocityController(VelocityGains gains) : gains(gains) {}
+
+        /**
+         * Works out the voltage for this update.
+         * @param double setpoint     The velocity wanted (rpm).
+         * @param double acceleration How fast the setpoint is changing (rpm/s).
+         * @param double measured     The velocity the motor is going (rpm).
+         * @param uint64_t time       Now (timer::systemHighResolution()), for
+         *                                the time since the last update.
+         * @returns double            The voltage to give the motor (volts).
+        */
+        double update(double setpoint, double acceleration, double measured, uint64_t time);
+
+        /**
+         * Forgets the integral and the last update (when the motor is stopped).
+        */
+        void reset();
+
+        void setGains(VelocityGains gains) { this->gains = gains; }
+
+        /**
+         * Changes the most voltage the output may be (MAX_MOTOR_VOLTAGE to
+         * start with), like when the battery can give the motor more or less
+         * than MAX_MOTOR_VOLTAGE (see battery.h).
+         * @param double volts    The new limit (volts).
+        */
+        void setMaxVoltage(double volts) { maxVoltage = volts; }
+
+        /** @returns double    What the integral is adding right now (volts). */
+        double getIntegral() { return integral; }
+};
+
+/**
+ * Starts the wheel control task, which runs every wheel train's velocity
+ * controller every WHEEL_CONTROL_PERIOD milliseconds (see Wheel::control()).
+ * Called once by vexcodeInit().
+*/
+void startWheelControl();
+
+#endif
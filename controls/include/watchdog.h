@@ -0,0 +1,108 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       watchdog.h                                                      */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Control Loop Stall Watchdog Declarations                        */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef WATCHDOG_HEADER_GUARD
+#define WATCHDOG_HEADER_GUARD
+
+#include "vex.h"
+
+using namespace vex;
+
+class Ticker;
+
+/**
+ * How often (in milliseconds) the watchdog checks the loops it watches.
+*/
+const int WATCHDOG_PERIOD = 5;
+
+/**
+ * How late (in milliseconds) a watched loop's tick may be before the loop
+ * counts as stalled. Long enough that a tick that just ran a little long (see
+ * Ticker overruns) does not stop the robot, short enough that a stalled loop
+ * is caught before the robot has driven far (about an inch at 50 rpm, in the
+ * simulator's watchdog benchmark).
+*/
+const int WATCHDOG_MARGIN = 25;
+
+/** The most loops that can be watched. */
+const int MAX_WATCHED_LOOPS = 8;
+
+/**
+ * One time a loop stalled.
+*/
+struct StallRecord {
+    /** The name of the loop's Ticker, or nullptr if nothing has stalled. */
+    const char *name;
+
+    /** How long the loop went without starting a tick (µs). */
+    uint32_t duration;
+
+    /** When the stall was caught (timer::system(), ms). */
+    uint32_t time;
+};
+
+/**
+ * What the watchdog has seen, for the debug screen.
+*/
+struct WatchdogStats {
+    /** The number of stalls caught. */
+    uint32_t stalls;
+
+    /** The name of a loop that is stalled right now, or nullptr. */
+    const char *stalled;
+
+    /** The last stall that ended, and the longest one. */
+    StallRecord last, longest;
+};
+
+/**
+ * Adds a loop to the ones the watchdog watches. Called by Ticker's
+ * constructor for every Ticker given a name, so there is no need to call it
+ * anywhere else.
+*/
+void watchTicker(Ticker *ticker);
+
+/**
+ * Starts the high priority task that makes sure every watched loop starts
+ * each tick on time.
+ *
+ * If the work in a loop blocks (a slow screen call, an SD card write, waiting
+ * on a sensor, ...), then the velocities the motors were last given keep the
+ * robot driving. So as soon as a loop that is running (see
+ * Ticker::start() and Ticker::stop()) is WATCHDOG_MARGIN late starting a
+ * tick, every motor is stopped (see emergencyStop()). Once every stalled loop
+ * has started a tick again, the motors are let go and the wheels start again
+ * from rest.
+ *
+ * Each stall is recorded (see getWatchdogStats()), and how long the watchdog
+ * took to catch it and how long each of its checks took are recorded in
+ * stallDetectionHistogram and watchdogCheckHistogram (see latency.h).
+ *
+ * Loops are not checked while the robot is disabled (between competition
+ * periods), since their tasks are stopped then.
+ *
+ * Tasks only switch when the running one sleeps or yields, so only a stall
+ * that does (like any wait() or SDK call that waits on a device) lets the
+ * watchdog run at all. A loop that busy-waits or never returns without
+ * yielding starves the watchdog as well, whatever its priority, and is not
+ * caught.
+*/
+void startWatchdog();
+
+/**
+ * Checks every watched loop once, stopping the motors if one has stalled or
+ * letting them go if every stalled loop has recovered. Run every
+ * WATCHDOG_PERIOD by the watchdog task.
+*/
+void checkWatchedLoops();
+
+/** @returns WatchdogStats  What the watchdog has seen so far. */
+WatchdogStats getWatchdogStats();
+
+#endif
@@ -0,0 +1,92 @@
+# Simulator makefile
+#
+# Builds the controls program for Linux against the stand-in SDK in sim/
+# instead of the VEX toolchain, so it can be run and measured without a brain:
+#
+#   make -f sim.mk
+#   build-sim/controls-sim --input script.txt --log motors.csv
+#
+# See sim/include/sim.h for how the simulator works.
+#
+# Also builds the tools in tools/ that read files made by the robot:
+#
+#   build-sim/telemetry-stats telem*.bin
+#
+# and makes the autonomous trajectory tables (include/trajectoryTables.h, see
+# trajectories.h) again whenever a header changes. They are kept in the
+# repository, because the brain build cannot run programs on the computer.
+
+# show compiler output
+VERBOSE = 0
+
+ifeq ($(VERBOSE),0)
+Q = @
+else
+Q =
+endif
+
+SIM_BUILD = build-sim
+SIM_TARGET = $(SIM_BUILD)/controls-sim
+TOOL_TARGETS = $(SIM_BUILD)/telemetry-stats
+TRAJECTORY_GEN = $(SIM_BUILD)/trajectory-gen
+TRAJECTORY_TABLES = include/trajectoryTables.h
+
+CXX      = g++
+ECHO     = @echo
+MKDIR    = mkdir -p "$(@D)"
+
+# Same language and code generation restrictions as the brain build (mkenv.mk)
+SIM_FLAGS = -std=gnu++11 -O2 -g -Wall -Werror=return-type -fno-rtti -fno-exceptions -ffunction-sections -fdata-sections
+SIM_LNK_FLAGS = -Wl,--gc-sections
+
+# project sources, with main() renamed so the harness can start it as a task
+SRC_C   = $(wildcard src/*.cpp)
+SIM_C   = $(wildcard sim/src/*.cpp)
+SRC_H   = $(wildcard include/*.h) $(wildcard sim/include/*.h) $(wildcard tools/*.h)
+
+OBJ     = $(addprefix $(SIM_BUILD)/, $(addsuffix .o, $(basename $(SRC_C))))
+SIM_OBJ = $(addprefix $(SIM_BUILD)/, $(addsuffix .o, $(basename $(SIM_C))))
+
+INC = -Iinclude -Isim/include -Itools
+
+all: $(TRAJECTORY_TABLES) $(SIM_TARGET) $(TOOL_TARGETS)
+
+$(SIM_BUILD)/src/%.o: src/%.cpp $(SRC_H) sim.mk
+	$(Q)$(MKDIR)
+	$(ECHO) "CXX $<"
+	$(Q)$(CXX) $(SIM_FLAGS) -Dmain=vexMain $(INC) -c -o $@ $<
+
+$(SIM_BUILD)/sim/src/%.o: sim/src/%.cpp $(SRC_H) sim.mk
+	$(Q)$(MKDIR)
+	$(ECHO) "CXX $<"
+	$(Q)$(CXX) $(SIM_FLAGS) $(INC) -c -o $@ $<
+
+$(SIM_TARGET): $(OBJ) $(SIM_OBJ)
+	$(ECHO) "LINK $@"
+	$(Q)$(CXX) $(SIM_LNK_FLAGS) -o $@ $^
+
+# tools only use the file formats from include/, never the SDK
+$(SIM_BUILD)/telemetry-stats: tools/telemetryStats.cpp tools/telemetryLog.h include/telemetryFormat.h sim.mk
+	$(Q)$(MKDIR)
+	$(ECHO) "CXX $@"
+	$(Q)$(CXX) $(SIM_FLAGS) -Iinclude -Itools -o $@ $<
+
+# the generator needs the robot's constants, so it is built against the simulator's headers
+$(TRAJECTORY_GEN): tools/trajectoryGen.cpp $(filter-out $(TRAJECTORY_TABLES), $(SRC_H)) sim.mk
+	$(Q)$(MKDIR)
+	$(ECHO) "CXX $@"
+	$(Q)$(CXX) $(SIM_FLAGS) $(INC) -o $@ $<
+
+# made every build, so the flash each trajectory takes is always printed, but only replaced when the tables change
+# (so the rest is not rebuilt for nothing)
+$(TRAJECTORY_TABLES): $(TRAJECTORY_GEN) FORCE
+	$(Q)$(TRAJECTORY_GEN) $(SIM_BUILD)/trajectoryTables.h
+	$(Q)cmp -s $(SIM_BUILD)/trajectoryTables.h $@ || (echo "GEN $@" && cp $(SIM_BUILD)/trajectoryTables.h $@)
+
+clean:
+	$(info clean simulator)
+	$(Q)rm -rf $(SIM_BUILD)
+
+FORCE:
+
+.PHONY: all clean FORCE
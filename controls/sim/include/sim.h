@@ -0,0 +1,417 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       sim.h                                                           */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Simulator Control Declarations (host only)                      */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+/**
+ * The simulator runs the controls program on Linux against the stand-in SDK
+ * in v5_vcs.h. Everything runs on one host thread:
+ *
+ * - Time is virtual and measured in microseconds. It only moves forward when
+ *       every task is sleeping (just like the brain, where tasks are
+ *       cooperative) or when a task is charged for the cost of an SDK call
+ *       (see `sim::CostModel`).
+ * - Tasks (including the robot's main()) are run on their own stacks and are
+ *       switched between when they sleep or yield, highest priority first.
+ * - Every command sent to a motor is recorded with the time it was sent.
+ *
+ * Because nothing depends on the speed of the host, a run with the same
+ * inputs always produces the exact same motor commands.
+*/
+
+#ifndef SIM_HEADER_GUARD
+#define SIM_HEADER_GUARD
+
+#include <stdint.h>
+#include <vector>
+
+namespace sim {
+
+/*-------------------------------- Virtual Time -----------------------------------*/
+
+/** @returns uint64_t   The current virtual time, in microseconds. */
+uint64_t now();
+
+/**
+ * Charges the running task for work that takes time on the brain. The clock
+ * moves forward without letting any other task run (the brain does not
+ * preempt tasks either).
+*/
+void charge(uint32_t us);
+
+/**
+ * The (rough) cost of SDK calls on the brain, in microseconds. These are
+ * estimates, not measurements, so compare runs against each other rather than
+ * trusting the absolute numbers. `--no-cost` on the command line zeros them.
+*/
+struct CostModel {
+    uint32_t screenPrint = 40;
+    uint32_t screenClearScreen = 600;
+    uint32_t screenClearLine = 60;
+    uint32_t deviceRead = 2;
+    uint32_t motorCommand = 5;
+    uint32_t sdWrite = 5000;
+};
+
+extern CostModel costs;
+
+/*------------------------------------ Tasks --------------------------------------*/
+
+/**
+ * Creates a task that starts running the next time the scheduler picks it.
+ * @returns int     The task's id (never 0).
+*/
+int spawn(int (*callback)(void), int32_t priority, const char *name);
+
+/** Same as above for the `void` callbacks used by events and competition. */
+int spawn(void (*callback)(void), int32_t priority, const char *name);
+
+/** Suspends the running task for `us` microseconds of virtual time. */
+void sleepFor(uint64_t us);
+
+/** Suspends the running task until the virtual time is at least `time` (µs). */
+void sleepUntil(uint64_t time);
+
+/** Lets every other ready task of the same or higher priority run first. */
+void yield();
+
+/** @returns bool   Whether the task existed and was stopped. */
+bool stopTask(int id);
+
+int currentTask();
+int32_t taskPriority(int id);
+void setTaskPriority(int id, int32_t priority);
+
+/**
+ * Runs the scheduler until virtual time `until` (µs) or until every task has
+ * finished, whichever comes first.
+*/
+void run(uint64_t until);
+
+/**
+ * Stops every task, like the end of a match. Called from a task, it does not
+ * return, and run() returns straight after.
+*/
+void stopAll();
+
+/** Whether the competition is in the autonomous period (set by the harness). */
+void setAutonomousPeriod(bool autonomous);
+bool autonomousPeriod();
+
+/*---------------------------------- Controller -----------------------------------*/
+
+/** Indices for `setButton`, in the same order as the controller's members. */
+enum Button {
+    ButtonL1, ButtonL2, ButtonR1, ButtonR2,
+    ButtonUp, ButtonDown, ButtonLeft, ButtonRight,
+    ButtonX, ButtonB, ButtonY, ButtonA,
+    NUM_BUTTONS
+};
+
+/**
+ * Sets axis 1-4 of the primary controller (-127 to 127). Inputs should be set
+ * from a task (the harness uses a high priority one) so that they happen at
+ * the right virtual time.
+*/
+void setAxis(int axis, int32_t value);
+
+/**
+ * Sets the state of one button of the primary controller. Registered
+ * pressed()/released() callbacks are started as their own tasks, like the
+ * SDK's event threads do on the brain.
+*/
+void setButton(Button button, bool pressing);
+
+/** @returns Button   The button named like "L1" or "Up", or NUM_BUTTONS. */
+Button buttonFromName(const char *name);
+
+/*------------------------------------ Motors -------------------------------------*/
+
+enum class MotorCommandType {
+    setVelocity,
+    setStopping,
+    spin,
+    spinVelocity,
+    spinVoltage,
+    stop,
+    setMaxTorque
+};
+
+/**
+ * One command sent to a motor. `value` is the velocity (or voltage for
+ * spinVoltage) and `unit` the SDK unit enum it was given in, cast to int. For
+ * spinVelocity and spinVoltage, `value` is negative when spinning in reverse.
+ * For spin and stop, `value` is the direction or brake type.
+*/
+struct MotorCommand {
+    uint64_t time;
+    int32_t port;
+    MotorCommandType type;
+    double value;
+    int32_t unit;
+};
+
+/** @returns   Every motor command sent so far, in the order they were sent. */
+const std::vector<MotorCommand> &motorCommands();
+
+void recordMotorCommand(int32_t port, MotorCommandType type, double value, int32_t unit);
+
+/** @returns const char *   A short name for the command type (for logs). */
+const char *motorCommandName(MotorCommandType type);
+
+/**
+ * How the simulated motors respond, as a simple DC motor: the voltage (less
+ * what friction and any load take) sets the speed the motor heads for, and it
+ * gets there with a time constant standing in for the motor and the robot's
+ * inertia. Velocity commands go through a proportional controller like the
+ * motor's own, so they fall short under load just like on the robot.
+*/
+struct MotorModel {
+    /** Seconds to get about 63% of the way to a new speed. */
+    double timeConstant = 0.1;
+    /** Volts lost to friction in the gearbox and drive. */
+    double friction = 0.3;
+    /** Amps drawn when stalled at 12 V. */
+    double stallCurrent = 2.5;
+    /** Gain of the motor's own velocity controller (volts per volt of error). */
+    double velocityGain = 2.0;
+
+    /** Degrees C the motors start at, and cool back down towards. */
+    double ambientTemperature = 20;
+    /** How fast current heats a motor (degrees C per second, per amp squared). */
+    double heating = 0.064;
+    /** Seconds for a motor to cool about 63% of the way back to ambient. */
+    double coolingTime = 600;
+    /** The motors only report their temperature in whole steps of this many degrees C. */
+    double temperatureStep = 5;
+};
+
+/**
+ * How much of its current a motor's firmware still lets it draw at a
+ * temperature: all of it below 55 C, then half, a quarter and an eighth at
+ * 55, 60 and 65 C, and none from 70 C.
+*/
+double thermalThrottle(double celsius);
+
+extern MotorModel motorModel;
+
+/**
+ * Puts an extra load on the motor on a port (like a wheel rubbing, or one
+ * side of the robot pushing something), as volts it takes away.
+*/
+void setMotorLoad(int32_t port, double volts);
+double motorLoad(int32_t port);
+
+/*----------------------------------- Battery -------------------------------------*/
+
+/**
+ * The battery, as a voltage that falls as it is used up and sags while the
+ * motors draw current. A motor given a voltage command gets that fraction of
+ * commandVoltage of whatever the battery has right now (velocity commands
+ * too, through the motor's own controller), so a tired battery makes the
+ * same command slower, like on the robot.
+*/
+struct BatteryModel {
+    /** Volts with nothing drawn, when full and when empty. */
+    double fullVoltage = 12.8;
+    double emptyVoltage = 11.0;
+    /** Amp hours from full to empty. */
+    double capacity = 1.1;
+    /** Volts lost per amp the motors draw (ohms, the battery's and the wires'). */
+    double resistance = 0.15;
+    /** The battery voltage at which a motor given a command of x volts gets x volts. */
+    double commandVoltage = 12.0;
+};
+
+extern BatteryModel batteryModel;
+
+/** Sets how full the battery is (0 to 1, full to start with). */
+void setBatteryCharge(double fraction);
+
+/** @returns double   How full the battery is (0 to 1). */
+double batteryCharge();
+
+/** @returns double   The battery's voltage right now (sagging with what the motors draw), at no cost. */
+double batteryVoltage();
+
+/**
+ * Records what a motor drew over a step of the motor model, to use up the
+ * battery and sag its voltage.
+*/
+void drawCurrent(int32_t port, double amps, double dt);
+
+/*------------------------------------ Drive --------------------------------------*/
+
+/**
+ * The robot's drive as a differential drive on a flat field, so the inertial
+ * sensor has a heading to report and odometry can be checked against where
+ * the robot really is. The wheels turn with the drive motors (see
+ * MotorModel), but the robot turns less than the wheels say it should
+ * because they scrub sideways, just like on a real field.
+ *
+ * Each side of the robot goes with its wheel only while the wheel grips. A
+ * wheel asked to speed up or slow down faster than `traction` lets the robot
+ * breaks loose: the robot then only changes speed at `slidingTraction` of
+ * that, and the wheel, no longer carrying the robot, spins up (or locks up)
+ * much faster, until it comes back to the robot's speed and grips again.
+*/
+struct DriveModel {
+    double wheelDiameter = 4.0;
+    double trackWidth = 12.5;
+    /** How much further the wheels turn than they should for a turn (1 is no scrubbing). */
+    double scrub = 1.1;
+    /** The most the floor can speed a side of the robot up or slow it down (inches/s^2, about 0.3 g). */
+    double traction = 120;
+    /** How much of `traction` is left while the wheel slips (kinetic against static friction). */
+    double slidingTraction = 0.8;
+    /** How much of MotorModel#timeConstant is left while a wheel slips, without the robot on it. */
+    double slippingInertia = 0.3;
+    /** How fast the inertial sensor's heading drifts away from the truth (degrees per minute). */
+    double inertialDrift = 1.0;
+    /** How long the inertial sensor takes to calibrate (µs). */
+    uint64_t calibrationTime = 2000000;
+};
+
+extern DriveModel driveModel;
+
+/** Where the robot really is: inches, and degrees clockwise (like Pose in odometry.h). */
+struct TruePose {
+    double x, y, heading;
+};
+
+/**
+ * Attaches the drive to the motors on two ports and puts the robot at 0, 0
+ * facing straight ahead.
+*/
+void setDrive(int32_t leftPort, int32_t rightPort);
+
+/**
+ * Moves the robot along by however far the drive motors have turned since the
+ * last call. The harness calls it every millisecond; the more often, the
+ * closer it follows curves. Costs no virtual time.
+*/
+void updateDrive();
+
+/** @returns TruePose   Where the robot really is, as of the last updateDrive(). */
+TruePose truePose();
+
+/** @returns bool   Whether the wheel of the drive motor on a port is slipping, as of the last updateDrive(). */
+bool wheelSlipping(int32_t port);
+
+/** @returns double   How fast the robot is really speeding up, straight ahead (inches/s^2). */
+double forwardAcceleration();
+
+/** @returns double   How fast the robot is really turning, clockwise (degrees/s). */
+double turnRate();
+
+/** @returns double   How far a drive motor has turned (turns), without the cost of reading it. */
+double motorTurns(int32_t port);
+
+/** @returns double   How fast a drive motor is turning (rpm), without the cost of reading it. */
+double motorVelocity(int32_t port);
+
+/** Sets how hot a motor is (degrees C), like after a match. */
+void setMotorTemperature(int32_t port, double celsius);
+
+/** @returns double   How hot a motor really is (degrees C, not rounded to temperatureStep), at no cost. */
+double motorTemperature(int32_t port);
+
+/*------------------------------------- Balls -------------------------------------*/
+
+/**
+ * The balls' path through the robot, in inches on from the sensor at the
+ * intake's mouth. A ball is carried by the intake rollers up to `liftEntry`,
+ * and by the lift from there. Carried past `exit` it is scored, and pushed back
+ * out past the mouth it is dropped. A ball carried into the one ahead of it
+ * stops against it (the rollers only rub on it), so balls never overlap.
+*/
+struct BallModel {
+    double diameter = 6.3;
+    /** How far a ball is carried for each turn of the intake and lift motors (inches). */
+    double intakeInchesPerTurn = 8.6;
+    double liftInchesPerTurn = 8.6;
+    /** Which way (1 forward, -1 reverse) the intake motor turns to carry balls in, and the lift motor to carry them up. */
+    double intakeDirection = 1;
+    double liftDirection = -1;
+    double liftEntry = 8;
+    /** Where the top sensor sees a ball, and where it leaves the robot (inches). */
+    double topSensor = 24;
+    double exit = 28;
+    /** How far either side of a sensor a ball can be and still be seen (inches, less than half a ball). */
+    double sensorReach = 2.4;
+};
+
+extern BallModel ballModel;
+
+/**
+ * Attaches the balls' path to the intake and lift motors on two ports, and
+ * the optical sensors at the mouth and the top on two more. Starts empty.
+*/
+void setIndexer(int32_t intakePort, int32_t liftPort, int32_t mouthPort, int32_t topPort);
+
+/**
+ * Carries the balls along by however far the intake and lift motors turned
+ * since the last call. Called whenever an optical sensor is read; the harness
+ * can call it more often. Costs no virtual time.
+*/
+void updateBalls();
+
+/**
+ * Puts a ball in front of the mouth (like the robot driving into one).
+ * @returns bool    Whether there was room (not if the last one is still there).
+*/
+bool feedBall();
+
+/** Puts a ball at the top of the lift (like the preload). */
+void loadBall();
+
+/** @returns bool   Whether a ball is in front of the optical sensor on a port. */
+bool ballNear(int32_t port);
+
+/** @returns int   How many balls are really in the robot. */
+int ballsInRobot();
+
+/** @returns double   Where a ball really is (inches, the one nearest the top first). */
+double ballPosition(int index);
+
+/** How many balls were really scored out of the top and dropped out of the mouth. */
+int ballsScored();
+int ballsDropped();
+
+/*----------------------------------- SD Card -------------------------------------*/
+
+/**
+ * Sets the host directory that acts as the brain's SD card. With no directory
+ * (the default) there is no SD card inserted.
+*/
+void setSdDirectory(const char *path);
+const char *sdDirectory();
+
+/*------------------------------------ Screen -------------------------------------*/
+
+/** 272 pixels tall with the default 20 pixel font. */
+const int SCREEN_ROWS = 13;
+const int SCREEN_COLUMNS = 48;
+
+/** Counts of calls made on the brain's screen. */
+struct ScreenStats {
+    uint64_t prints = 0;
+    uint64_t clearScreens = 0;
+    uint64_t clearLines = 0;
+    uint64_t cursorMoves = 0;
+
+    uint64_t total() const { return prints + clearScreens + clearLines + cursorMoves; }
+};
+
+ScreenStats &screenStats();
+
+/** @returns const char *   The text currently shown on a row of the screen. */
+const char *screenRow(int row);
+
+}
+
+#endif
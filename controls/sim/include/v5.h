@@ -0,0 +1,54 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       v5.h (simulator)                                                */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Host Stand-in For The V5 SDK C Header                           */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+/**
+ * This header (and v5_vcs.h next to it) take the place of the VEX SDK headers
+ * when the controls program is built for Linux with `make -f sim.mk`. They are
+ * NEVER seen by the VEXcode build, which uses the real SDK headers from the
+ * toolchain.
+ *
+ * Only the parts of the SDK that our program actually uses are provided. If
+ * you use something new from the SDK in src/, then it has to be added here as
+ * well (with the same name and signature as the real one) or the simulator
+ * build will fail.
+*/
+
+#ifndef SIM_V5_HEADER_GUARD
+#define SIM_V5_HEADER_GUARD
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** Smart ports are zero based in the SDK, PORT1 is index 0. */
+#define PORT1   0
+#define PORT2   1
+#define PORT3   2
+#define PORT4   3
+#define PORT5   4
+#define PORT6   5
+#define PORT7   6
+#define PORT8   7
+#define PORT9   8
+#define PORT10  9
+#define PORT11 10
+#define PORT12 11
+#define PORT13 12
+#define PORT14 13
+#define PORT15 14
+#define PORT16 15
+#define PORT17 16
+#define PORT18 17
+#define PORT19 18
+#define PORT20 19
+#define PORT21 20
+
+/** The number of smart ports on the brain. */
+#define V5_MAX_DEVICE_PORTS 21
+
+#endif
@@ -0,0 +1,369 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       v5_vcs.h (simulator)                                            */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Host Stand-in For The V5 SDK C++ Classes                        */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+/**
+ * See v5.h. The classes here have the same names and signatures as the ones in
+ * the real SDK so that src/ compiles unchanged, but they talk to the simulator
+ * (sim.h) instead of smart ports.
+*/
+
+#ifndef SIM_V5_VCS_HEADER_GUARD
+#define SIM_V5_VCS_HEADER_GUARD
+
+#include "v5.h"
+#include "sim.h"
+
+namespace vex {
+
+/*------------------------------------ Units --------------------------------------*/
+
+enum class percentUnits { pct = 0 };
+enum class timeUnits { sec, msec };
+enum class currentUnits { amp };
+enum class voltageUnits { volt, mV };
+enum class rotationUnits { deg, rev, raw };
+enum class velocityUnits { pct = 0, rpm, dps };
+enum class directionType { fwd = 0, rev, undefined };
+enum class brakeType { coast = 0, brake, hold, undefined };
+enum class gearSetting { ratio36_1 = 0, ratio18_1, ratio6_1 };
+enum class temperatureUnits { celsius, fahrenheit };
+enum class axisType { xaxis, yaxis, zaxis };
+
+const percentUnits percent = percentUnits::pct;
+const timeUnits seconds = timeUnits::sec;
+const timeUnits msec = timeUnits::msec;
+const currentUnits amp = currentUnits::amp;
+const voltageUnits volt = voltageUnits::volt;
+const voltageUnits mV = voltageUnits::mV;
+const rotationUnits degrees = rotationUnits::deg;
+const rotationUnits turns = rotationUnits::rev;
+const velocityUnits rpm = velocityUnits::rpm;
+const velocityUnits dps = velocityUnits::dps;
+const directionType forward = directionType::fwd;
+const directionType reverse = directionType::rev;
+const brakeType coast = brakeType::coast;
+const brakeType brake = brakeType::brake;
+const brakeType hold = brakeType::hold;
+const gearSetting ratio36_1 = gearSetting::ratio36_1;
+const gearSetting ratio18_1 = gearSetting::ratio18_1;
+const gearSetting ratio6_1 = gearSetting::ratio6_1;
+const temperatureUnits celsius = temperatureUnits::celsius;
+const temperatureUnits fahrenheit = temperatureUnits::fahrenheit;
+
+/*------------------------------------ Time ---------------------------------------*/
+
+/** Sleeps the calling task. */
+void wait(double time, timeUnits units = timeUnits::sec);
+
+class timer {
+    private:
+        uint64_t start;
+    public:
+        timer();
+
+        /** @returns uint32_t   Milliseconds since the timer was cleared. */
+        uint32_t time();
+        double time(timeUnits units);
+        void clear();
+        /** @returns double   Seconds since the timer was cleared. */
+        double value();
+
+        /** @returns uint32_t   Milliseconds since the brain started. */
+        static uint32_t system();
+        /** @returns uint64_t   Microseconds since the brain started. */
+        static uint64_t systemHighResolution();
+};
+
+/*------------------------------------ Tasks --------------------------------------*/
+
+class task {
+    private:
+        int id;
+    public:
+        static const int32_t taskPriorityLow = 1;
+        static const int32_t taskPriorityNormal = 7;
+        static const int32_t taskPriorityHigh = 15;
+
+        task();
+        task(int (*callback)(void));
+        task(int (*callback)(void), int32_t priority);
+
+        bool stop();
+        void suspend() {}
+        void resume() {}
+        int32_t priority();
+        void setPriority(int32_t priority);
+
+        static void sleep(uint32_t time);
+        static void yield();
+};
+
+namespace this_thread {
+    int32_t get_id();
+    void yield();
+    void sleep_for(uint32_t time);
+    /** @param time     The system time (ms) to sleep until. */
+    void sleep_until(uint64_t time);
+    int32_t priority();
+    void setPriority(int32_t priority);
+}
+
+/** Tasks are cooperative, so a mutex only has to remember who holds it. */
+class mutex {
+    private:
+        int owner = 0;
+    public:
+        void lock();
+        bool try_lock();
+        void unlock();
+};
+
+/*------------------------------------ Brain --------------------------------------*/
+
+class brain {
+    public:
+        class lcd {
+            private:
+                int cursorRow = 0;
+                int cursorColumn = 0;
+                int originX = 0;
+                int originY = 0;
+                void write(const char *text);
+            public:
+                void print(const char *format, ...);
+                template <class T> void print(T value) { printValue(value); }
+                void printAt(int32_t x, int32_t y, const char *format, ...);
+                void setCursor(int32_t row, int32_t col);
+                int32_t row() { return cursorRow + 1; }
+                int32_t column() { return cursorColumn + 1; }
+                void newLine();
+                void clearScreen();
+                void clearLine();
+                void clearLine(int32_t number);
+                void setOrigin(int32_t x, int32_t y);
+            private:
+                void printValue(int32_t value);
+                void printValue(uint32_t value);
+                void printValue(long value);
+                void printValue(unsigned long value);
+                void printValue(long long value);
+                void printValue(unsigned long long value);
+                void printValue(double value);
+                void printValue(bool value) { printValue((int32_t)value); }
+        };
+
+        class battery {
+            public:
+                int32_t capacity(percentUnits units = percentUnits::pct);
+                double voltage(voltageUnits units = voltageUnits::volt);
+                double current(currentUnits units = currentUnits::amp);
+        };
+
+        /** Files are kept in the directory given to the harness with `--sd`. */
+        class sdcard {
+            public:
+                bool isInserted();
+                int32_t loadfile(const char *name, uint8_t *buffer, int32_t len);
+                int32_t savefile(const char *name, uint8_t *buffer, int32_t len);
+                int32_t appendfile(const char *name, uint8_t *buffer, int32_t len);
+                int32_t size(const char *name);
+                bool exists(const char *name);
+        };
+
+        lcd Screen;
+        battery Battery;
+        sdcard SDcard;
+        timer Timer;
+};
+
+/*---------------------------------- Controller -----------------------------------*/
+
+enum class controllerType { primary = 0, partner };
+
+class controller {
+    public:
+        class axis {
+            private:
+                int index;
+            public:
+                axis(int index) : index(index) {}
+                int32_t value();
+                int32_t position(percentUnits units = percentUnits::pct);
+        };
+
+        class button {
+            private:
+                int index;
+            public:
+                button(int index) : index(index) {}
+                bool pressing();
+                void pressed(void (*callback)(void));
+                void released(void (*callback)(void));
+        };
+
+        controller() {}
+        controller(controllerType type) { (void)type; }
+
+        axis Axis1 = axis(1);
+        axis Axis2 = axis(2);
+        axis Axis3 = axis(3);
+        axis Axis4 = axis(4);
+
+        button ButtonL1 = button(sim::ButtonL1);
+        button ButtonL2 = button(sim::ButtonL2);
+        button ButtonR1 = button(sim::ButtonR1);
+        button ButtonR2 = button(sim::ButtonR2);
+        button ButtonUp = button(sim::ButtonUp);
+        button ButtonDown = button(sim::ButtonDown);
+        button ButtonLeft = button(sim::ButtonLeft);
+        button ButtonRight = button(sim::ButtonRight);
+        button ButtonX = button(sim::ButtonX);
+        button ButtonB = button(sim::ButtonB);
+        button ButtonY = button(sim::ButtonY);
+        button ButtonA = button(sim::ButtonA);
+};
+
+/*------------------------------------ Motors -------------------------------------*/
+
+class motor {
+    private:
+        int32_t port;
+        gearSetting gears;
+        bool reversed;
+        brakeType stopping = brakeType::coast;
+
+        /* What the motor was last told to do. */
+        enum class Mode { stopped, velocity, voltage };
+        Mode mode = Mode::stopped;
+        brakeType braking = brakeType::coast;
+        /* The velocity it is spinning at (rpm), or the voltage (volts). Negative in reverse. */
+        double target = 0;
+
+        /* The velocity set with setVelocity(), in rpm. */
+        double velocitySetting = 0;
+        /* The velocity the motor is spinning at right now, in rpm. */
+        double currentVelocity = 0;
+        /* The voltage the motor is giving itself right now. */
+        double appliedVoltage = 0;
+        /* The most current the motor may draw, as a fraction of the stall current (see setMaxTorque()). */
+        double maxTorque = 1;
+        /* How hot the motor is (degrees C), see sim::MotorModel. */
+        double temperatureC = sim::motorModel.ambientTemperature;
+        /* Rotations of the motor when `positionTime` was reached. */
+        double positionRevs = 0;
+        uint64_t positionTime = 0;
+
+        void updatePosition();
+        void simulateStep(double dt);
+        void updateTemperature(double dt, double current);
+        void startSpinning(directionType dir);
+        double maxRpm();
+        double toRpm(double value, velocityUnits units);
+    public:
+        motor(int32_t index);
+        motor(int32_t index, bool reverse);
+        motor(int32_t index, gearSetting gears, bool reverse = false);
+
+        int32_t index() { return port; }
+        void setReversed(bool value) { reversed = value; }
+        void setStopping(brakeType mode);
+        void setVelocity(double velocity, velocityUnits units);
+        void setVelocity(double velocity, percentUnits units);
+        void setMaxTorque(double value, percentUnits units);
+        void setMaxTorque(double value, currentUnits units);
+
+        void spin(directionType dir);
+        void spin(directionType dir, double velocity, velocityUnits units);
+        void spin(directionType dir, double voltage, voltageUnits units);
+        void stop();
+        void stop(brakeType mode);
+
+        bool isSpinning();
+        double velocity(velocityUnits units);
+        double position(rotationUnits units);
+        void resetPosition();
+        double current(currentUnits units = currentUnits::amp);
+        double temperature(temperatureUnits units);
+
+        friend double sim::motorTurns(int32_t port);
+        friend void sim::setMotorTemperature(int32_t port, double celsius);
+        friend double sim::motorTemperature(int32_t port);
+        friend double sim::motorVelocity(int32_t port);
+};
+
+/**
+ * The inertial sensor reports the heading of the simulated drive (see
+ * sim::DriveModel), drifting slowly like the real one, how fast it is
+ * speeding up straight ahead (along the y axis, in g) and how fast it is
+ * turning (about the z axis).
+*/
+class inertial {
+    private:
+        int32_t port;
+        uint64_t calibrationEnd = 0;
+        /* Subtracted from the heading, for resetRotation() and setRotation(). */
+        double offset = 0;
+    public:
+        inertial(int32_t index) : port(index) {}
+
+        int32_t index() { return port; }
+        bool installed() { return true; }
+        void calibrate();
+        bool isCalibrating();
+        double rotation(rotationUnits units = rotationUnits::deg);
+        double heading(rotationUnits units = rotationUnits::deg);
+        void resetRotation();
+        void setRotation(double value, rotationUnits units);
+        double acceleration(axisType axis);
+        double gyroRate(axisType axis, velocityUnits units);
+};
+
+/*------------------------------------ Optical ------------------------------------*/
+
+/**
+ * Only the proximity is simulated: whether a ball is in front of the sensor
+ * (see sim::BallModel). Anything else is in front of it only on the robot.
+*/
+class optical {
+    private:
+        int32_t port;
+    public:
+        optical(int32_t index) : port(index) {}
+
+        int32_t index() { return port; }
+        bool installed() { return true; }
+        bool isNearObject();
+};
+
+/*------------------------------------ Others -------------------------------------*/
+
+/** Vision sensors are not simulated; only the types are provided. */
+class vision {
+    public:
+        class signature {};
+        class code {};
+};
+
+/**
+ * The simulator does not switch between competition periods. The callback for
+ * the period chosen on the harness command line (`--auton`) is started when it
+ * is registered, and the other one is never called.
+*/
+class competition {
+    public:
+        void autonomous(void (*callback)(void));
+        void drivercontrol(void (*callback)(void));
+        static bool isEnabled() { return true; }
+        static bool isAutonomous();
+        static bool isDriverControl() { return !isAutonomous(); }
+};
+
+}
+
+#endif
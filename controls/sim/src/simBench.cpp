@@ -0,0 +1,1466 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       simBench.cpp                                                    */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Simulator Benchmarks                                            */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+/**
+ * Benchmarks run with `build-sim/controls-sim --bench <name>`. Each one runs
+ * part of the robot program in a simulator task and prints what it costs.
+ * Costs in virtual microseconds come from sim::CostModel, so they are only
+ * useful for comparing runs with each other.
+*/
+
+#include "vex.h"
+#include "debugScreen.h"
+#include "telemetry.h"
+#include "functionality.h"
+#include "odometry.h"
+#include "driveMoves.h"
+#include "pathFollower.h"
+#include "trajectories.h"
+#include "actuatorCommands.h"
+#include "emergencyStop.h"
+#include "watchdog.h"
+#include "thermal.h"
+#include "battery.h"
+#include "traction.h"
+#include "indexer.h"
+#include "latency.h"
+#include "ticker.h"
+#include "sim.h"
+
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+using namespace vex;
+
+/*---------------------------------- Debug Screen ---------------------------------*/
+
+static const int SCREEN_BENCH_FRAMES = 1000;
+
+struct ScreenBenchResult {
+    double callsPerFrame;
+    double microsecondsPerFrame;
+};
+
+/* Draws frames with or without the sticks moving, optionally clearing the screen before each one. */
+static ScreenBenchResult benchFrames(bool sticksChange, bool fullRedraw) {
+    DebugSnapshot snapshot;
+    memset(&snapshot, 0, sizeof(snapshot));
+    for(int i=0; i<NUM_MOTORS; i++) {
+        snapshot.temperatures[i] = i < NUM_WHEEL_TRAINS ? 35 : 30;
+        snapshot.secondsToThrottle[i] = -1;
+    }
+    snapshot.drivePower = 1;
+    snapshot.tickPeriod = 50000;
+
+    resetDebug();
+    debugMenuController(snapshot);
+
+    uint64_t calls = sim::screenStats().total();
+    uint64_t start = sim::now();
+    for(int frame = 0; frame < SCREEN_BENCH_FRAMES; frame++) {
+        if(sticksChange) {
+            snapshot.input.axes[Axis3] = frame % 255 - 127;
+            snapshot.input.axes[Axis1] = (frame * 7) % 255 - 127;
+            snapshot.wheelVelocities[0] = snapshot.input.axes[Axis3] / 2;
+            snapshot.wheelVelocities[1] = -snapshot.input.axes[Axis3] / 2;
+        }
+        if(fullRedraw) { resetDebug(); }
+        debugMenuController(snapshot);
+    }
+
+    ScreenBenchResult result;
+    result.callsPerFrame = (double)(sim::screenStats().total() - calls) / SCREEN_BENCH_FRAMES;
+    result.microsecondsPerFrame = (double)(sim::now() - start) / SCREEN_BENCH_FRAMES;
+    return result;
+}
+
+static void screenBench() {
+    ScreenBenchResult idle = benchFrames(false, false);
+    ScreenBenchResult driving = benchFrames(true, false);
+    ScreenBenchResult redraw = benchFrames(true, true);
+
+    printf("debug screen, %d frames each\n", SCREEN_BENCH_FRAMES);
+    printf("    %-28s %8s %12s\n", "", "calls", "us (virtual)");
+    printf("    %-28s %8.1f %12.1f\n", "nothing changing", idle.callsPerFrame, idle.microsecondsPerFrame);
+    printf("    %-28s %8.1f %12.1f\n", "sticks and rpm changing", driving.callsPerFrame, driving.microsecondsPerFrame);
+    printf("    %-28s %8.1f %12.1f\n", "full redraw every frame", redraw.callsPerFrame, redraw.microsecondsPerFrame);
+}
+
+/*----------------------------------- Telemetry -----------------------------------*/
+
+static const int TELEMETRY_BENCH_RECORDS = 1000000;
+
+/* Separate from telemetryBuffer so the benchmark can fill it without a telemetry task draining it. */
+static TelemetryBuffer benchBuffer;
+
+static void telemetryBench() {
+    TelemetryRecord record;
+    memset(&record, 0, sizeof(record));
+    const TelemetryRecord *first;
+
+    //push() on its own, in real time on this computer (it makes no SDK calls)
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int i = 0; i < TELEMETRY_BENCH_RECORDS; i++) {
+        record.time = (uint32_t)i;
+        benchBuffer.push(record);
+        if(benchBuffer.size() >= TELEMETRY_BLOCK_RECORDS) {
+            benchBuffer.release(benchBuffer.peek(first));
+        }
+    }
+    double pushNanoseconds = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count()
+        / TELEMETRY_BENCH_RECORDS;
+
+    //A whole recordTelemetry() call, in virtual time (the device reads)
+    strcpy(telemetryFile, "bench.bin");
+    InputFrame input;
+    memset(&input, 0, sizeof(input));
+    uint64_t virtualStart = sim::now();
+    for(int i = 0; i < TELEMETRY_BENCH_RECORDS / 1000; i++) { recordTelemetry(input, false); }
+    double recordMicroseconds = (double)(sim::now() - virtualStart) / (TELEMETRY_BENCH_RECORDS / 1000);
+
+    //With nothing draining it, the buffer fills up and the rest are dropped instead of waiting
+    benchBuffer.release(benchBuffer.peek(first));
+    uint32_t droppedBefore = benchBuffer.getDropped();
+    for(uint32_t i = 0; i < TelemetryBuffer::CAPACITY + 100; i++) { benchBuffer.push(record); }
+
+    printf("telemetry, record is %u bytes, buffer holds %lu records\n", (unsigned)sizeof(TelemetryRecord),
+        (unsigned long)TelemetryBuffer::CAPACITY);
+    printf("    push                        %8.1f ns (real)\n", pushNanoseconds);
+    printf("    recordTelemetry             %8.1f us (virtual, device reads)\n", recordMicroseconds);
+    printf("    pushing %lu into an empty buffer: %lu kept, %lu dropped\n",
+        (unsigned long)(TelemetryBuffer::CAPACITY + 100), (unsigned long)benchBuffer.size(),
+        (unsigned long)(benchBuffer.getDropped() - droppedBefore));
+}
+
+/*------------------------------------ Sticks -------------------------------------*/
+
+static const int STICK_BENCH_ROUNDS = 200000;
+
+/* What movement() used to do with the sticks, for comparison. Not static, so it can't be worked out ahead of time. */
+double benchPercentOfMaxSpeed = .4;
+volatile int benchSink;
+
+static void sticksBench() {
+    //Every stick value in a mixed up order, so neither version gets to predict the next one
+    int32_t values[STICK_VALUES];
+    for(int i = 0; i < STICK_VALUES; i++) { values[i] = (i * 97) % STICK_VALUES - 127; }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int round = 0; round < STICK_BENCH_ROUNDS; round++) {
+        for(int i = 0; i < STICK_VALUES; i++) {
+            int32_t forward = values[i], turning = values[STICK_VALUES - 1 - i];
+            benchSink = (int)(forward * benchPercentOfMaxSpeed) + (int)((int)(turning / 2.0) * benchPercentOfMaxSpeed);
+        }
+    }
+    double arithmetic = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for(int round = 0; round < STICK_BENCH_ROUNDS; round++) {
+        for(int i = 0; i < STICK_VALUES; i++) {
+            int32_t forward = values[i], turning = values[STICK_VALUES - 1 - i];
+            benchSink = forwardTables[driverProfile][speedMode][forward] + turningTables[driverProfile][speedMode][turning];
+        }
+    }
+    double tables = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    double calls = (double)STICK_BENCH_ROUNDS * STICK_VALUES;
+    printf("sticks to rpm, %.0f ticks each (real time on this computer)\n", calls);
+    printf("    %-28s %8.2f ns/tick\n", "double arithmetic (old)", arithmetic / calls);
+    printf("    %-28s %8.2f ns/tick\n", "lookup tables", tables / calls);
+    printf("    tables use %u bytes of flash\n", (unsigned)(sizeof(forwardTables) + sizeof(turningTables)));
+}
+
+/*-------------------------------- Motion Profile ---------------------------------*/
+
+static const int PROFILE_BENCH_STEPS = 10000000;
+
+/* Follows one speed change and prints how long it took and whether the limits held. */
+static void profileRun(const char *name, ProfileLimits limits, int from, int to) {
+    MotionProfile profile(limits, TICK_LENGTH);
+    profile.reset(from);
+    int ticks = 0, previous = from, previousAcceleration = 0;
+    int32_t peakAcceleration = 0, peakJerk = 0, overshoot = 0;
+    while(ticks < 1000 && (ticks == 0 || profile.getVelocity() != to || profile.getAcceleration() != 0)) {
+        int velocity = profile.step(to);
+        int acceleration = (velocity - previous) * 1000 / TICK_LENGTH;
+        int32_t jerk = abs(acceleration - previousAcceleration) * 1000 / TICK_LENGTH;
+        if(abs(acceleration) > peakAcceleration) { peakAcceleration = abs(acceleration); }
+        if(jerk > peakJerk) { peakJerk = jerk; }
+        if((to - velocity) * (to - from) < 0 && abs(to - velocity) > overshoot) { overshoot = abs(to - velocity); }
+        previous = velocity;
+        previousAcceleration = acceleration;
+        ticks++;
+    }
+    printf("    %-26s %4d -> %4d rpm in %3d ticks (%4d ms), peak %5ld rpm/s, peak jerk %6ld rpm/s^2, overshoot %ld\n",
+        name, from, to, ticks, ticks * TICK_LENGTH, (long)peakAcceleration, (long)peakJerk, (long)overshoot);
+}
+
+static void profileBench() {
+    ProfileLimits trapezoid = {DRIVER_LIMITS.maxAcceleration, 0};
+    printf("driver limits: %ld rpm/s, %ld rpm/s^2, %d ms ticks (jerk is measured on whole rpm, so it is rounded)\n",
+        (long)DRIVER_LIMITS.maxAcceleration, (long)DRIVER_LIMITS.maxJerk, TICK_LENGTH);
+    profileRun("trapezoid, start", trapezoid, 0, 50);
+    profileRun("S-curve, start", DRIVER_LIMITS, 0, 50);
+    profileRun("S-curve, stop", DRIVER_LIMITS, 50, 0);
+    profileRun("S-curve, reverse", DRIVER_LIMITS, 50, -50);
+    profileRun("S-curve, small change", DRIVER_LIMITS, 20, 22);
+    profileRun("S-curve, autonomous", AUTONOMOUS_LIMITS, 0, 50);
+
+    //Turning from a stop: the wheels should keep the same ratio the whole way
+    setWheelGoals(30, 20);
+    int worst = 0, ticks = 0;
+    while(ticks < 100 && (leftWheelTrain.getVelocity() != 50 || rightWheelTrain.getVelocity() != 10)) {
+        updateWheels();
+        //Right should be a fifth of left (rounding both to whole rpm allows 3 rpm)
+        int error = abs(leftWheelTrain.getVelocity() - 5 * rightWheelTrain.getVelocity());
+        if(error > worst) { worst = error; }
+        ticks++;
+    }
+    printf("    turn from stop: 0 -> 50/10 rpm in %d ticks, worst ratio error %d rpm (left - 5 * right)\n", ticks, worst);
+    leftWheelTrain.setVelocity(0);
+    rightWheelTrain.setVelocity(0);
+
+    MotionProfile profile(DRIVER_LIMITS, TICK_LENGTH);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int i = 0; i < PROFILE_BENCH_STEPS; i++) {
+        benchSink = profile.step((i & 64) ? 50 : -50);
+    }
+    double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    printf("    step(): %.2f ns (real time on this computer)\n", elapsed / PROFILE_BENCH_STEPS);
+}
+
+/*------------------------------- Velocity Control --------------------------------*/
+
+/* What one run of the wheels bench saw. */
+struct WheelRun {
+    double riseTime[NUM_WHEEL_TRAINS];
+    double peak[NUM_WHEEL_TRAINS];
+    double steadyError[NUM_WHEEL_TRAINS];
+    double revolutionGap;
+};
+
+/*
+ * Runs both wheel trains up to `goal` rpm (through the motion profile, every
+ * tick) for two seconds, either closed loop (our controller, every
+ * WHEEL_CONTROL_PERIOD like the wheel control task) or open loop (just asking
+ * the motors for the velocity, like before). If `stallTime`
+ * is set, the left wheel is held still for that long first (like pushing a
+ * wall) to check that the integral does not wind up.
+*/
+static WheelRun wheelRun(bool closedLoop, int goal, double leftLoad, int stallTime) {
+    WheelRun run = {};
+    for(int i = 0; i < NUM_WHEEL_TRAINS; i++) {
+        wheelTrains[i]->setVelocity(0);
+        wheelTrains[i]->stop(brake);
+    }
+    wait(1000, msec);
+    for(int i = 0; i < NUM_WHEEL_TRAINS; i++) { wheelTrains[i]->wheelMotor.device->resetPosition(); }
+
+    int32_t leftPort = leftWheelTrain.wheelMotor.device->index();
+    sim::setMotorLoad(leftPort, stallTime > 0 ? 12 : leftLoad);
+    for(int i = 0; i < NUM_WHEEL_TRAINS; i++) { wheelTrains[i]->setGoalVelocity(goal); }
+
+    int steadySamples = 0;
+    for(int time = 0; time < 2000 + stallTime; time += WHEEL_CONTROL_PERIOD) {
+        if(stallTime > 0 && time == stallTime) { sim::setMotorLoad(leftPort, leftLoad); }
+        for(int i = 0; i < NUM_WHEEL_TRAINS; i++) {
+            //The setpoint follows the motion profile every tick, like when driving
+            if(time % TICK_LENGTH == 0) {
+                wheelTrains[i]->updateVelocity();
+                if(!closedLoop) { wheelTrains[i]->spin(forward); }
+            }
+            if(closedLoop) { wheelTrains[i]->control(); }
+            double measured = wheelTrains[i]->wheelMotor.device->velocity(rpm);
+            int sinceStart = time - stallTime;
+            if(sinceStart >= 0 && run.riseTime[i] == 0 && measured >= goal * 0.9) { run.riseTime[i] = sinceStart; }
+            if(sinceStart >= 0 && measured > run.peak[i]) { run.peak[i] = measured; }
+            if(sinceStart >= 1000) { run.steadyError[i] += fabs(goal - measured); }
+        }
+        if(time - stallTime >= 1000) { steadySamples++; }
+        wait(WHEEL_CONTROL_PERIOD, msec);
+    }
+    for(int i = 0; i < NUM_WHEEL_TRAINS; i++) { run.steadyError[i] /= steadySamples; }
+    run.revolutionGap = rightWheelTrain.wheelMotor.device->position(rotationUnits::rev) - leftWheelTrain.wheelMotor.device->position(rotationUnits::rev);
+
+    sim::setMotorLoad(leftPort, 0);
+    for(int i = 0; i < NUM_WHEEL_TRAINS; i++) {
+        wheelTrains[i]->setVelocity(0);
+        wheelTrains[i]->control();
+    }
+    return run;
+}
+
+static void printWheelRun(const char *name, const WheelRun &run) {
+    printf("    %-24s rise %4.0f/%4.0f ms  peak %5.1f/%5.1f rpm  error %4.2f/%4.2f rpm  gap %5.2f rev\n", name,
+        run.riseTime[1], run.riseTime[0], run.peak[1], run.peak[0], run.steadyError[1], run.steadyError[0], run.revolutionGap);
+}
+
+static void wheelsBench() {
+    static_assert(NUM_WHEEL_TRAINS == 2, "The bench prints left/right");
+    printf("0 to 50 rpm for 2 s on the simulated DC motors (left/right, gap is how far the right side got ahead)\n");
+    tractionControl = false; //The wheels spin against loads, not the floor, so every start would look like a slip
+    printWheelRun("open loop, no load", wheelRun(false, 50, 0, 0));
+    printWheelRun("closed loop, no load", wheelRun(true, 50, 0, 0));
+    printWheelRun("open loop, left 1 V", wheelRun(false, 50, 1, 0));
+    printWheelRun("closed loop, left 1 V", wheelRun(true, 50, 1, 0));
+    printWheelRun("closed loop, 1 s stall", wheelRun(true, 50, 0, 1000));
+
+    //The cost of one controller update (real time)
+    VelocityController controller(WHEEL_GAINS);
+    double sum = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int i = 0; i < PROFILE_BENCH_STEPS; i++) {
+        sum += controller.update(50, 0, 45 + (i & 7), (uint64_t)i * 10000 + 1);
+    }
+    double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    benchSink = (int)sum;
+    printf("    update(): %.2f ns (real time on this computer)\n", elapsed / PROFILE_BENCH_STEPS);
+}
+
+/*----------------------------------- Odometry ------------------------------------*/
+
+/* One part of the odometry bench's route: the wheel velocities (rpm), and for how long. */
+struct RouteLeg {
+    const char *name;
+    int left, right;
+    int ms;
+};
+
+static const RouteLeg ODOMETRY_ROUTE[] = {
+    {"straight", 50, 50, 2000},
+    {"spin right", 40, -40, 1000},
+    {"arc left", 25, 50, 3000},
+    {"reverse", -40, -40, 1000},
+    {"arc right", 50, 30, 2000},
+    {"stop", 0, 0, 1000},
+};
+
+/* How far an odometry pose is from the truth (inches and degrees). */
+static double positionError(const Pose &pose, const sim::TruePose &truth) {
+    return sqrt((pose.x - truth.x) * (pose.x - truth.x) + (pose.y - truth.y) * (pose.y - truth.y));
+}
+
+static void odometryBench() {
+    printf("odometry against the simulated drive (scrub %.2f, inertial drift %.1f deg/min), every %d ms\n",
+        sim::driveModel.scrub, sim::driveModel.inertialDrift, ODOMETRY_PERIOD);
+    inertialSensor.calibrate();
+    while(inertialSensor.isCalibrating()) { wait(10, msec); }
+
+    int32_t leftPort = leftWheelTrainMotor.index(), rightPort = rightWheelTrainMotor.index();
+    sim::setDrive(leftPort, rightPort);
+    Odometry encodersOnly(0), fused(INERTIAL_TRUST);
+    double start = inertialSensor.rotation(degrees);
+    encodersOnly.reset(0, 0, 0, NAN);
+    fused.reset(0, 0, 0, start);
+
+    printf("    %-12s %21s %21s %21s\n", "", "really", "encoders only", "with inertial");
+    for(const RouteLeg &leg : ODOMETRY_ROUTE) {
+        leftWheelTrain.setGoalVelocity(leg.left);
+        rightWheelTrain.setGoalVelocity(leg.right);
+        for(int time = 0; time < leg.ms; time += 1) {
+            sim::updateDrive();
+            if(time % TICK_LENGTH == 0) { updateWheels(); }
+            if(time % WHEEL_CONTROL_PERIOD == 0) {
+                for(int i = 0; i < NUM_WHEEL_TRAINS; i++) { wheelTrains[i]->control(); }
+            }
+            if(time % ODOMETRY_PERIOD == 0) {
+                double left = sim::motorTurns(leftPort), right = sim::motorTurns(rightPort);
+                encodersOnly.update(left, right, NAN, timer::system());
+                fused.update(left, right, inertialSensor.rotation(degrees), timer::system());
+            }
+            wait(1, msec);
+        }
+        sim::TruePose truth = sim::truePose();
+        const Pose &a = encodersOnly.getPose(), &b = fused.getPose();
+        printf("    %-12s %6.1f %6.1f %6.1f   off %5.2f in %5.2f deg   off %5.2f in %5.2f deg\n", leg.name,
+            truth.x, truth.y, truth.heading, positionError(a, truth), fabs(a.heading - truth.heading),
+            positionError(b, truth), fabs(b.heading - truth.heading));
+    }
+
+    //The cost of one update, real and virtual
+    Odometry odometry(INERTIAL_TRUST);
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for(int i = 0; i < PROFILE_BENCH_STEPS; i++) {
+        odometry.update(i * 0.001, i * 0.0011, i * 0.01, (uint32_t)i * ODOMETRY_PERIOD);
+    }
+    double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - begin).count();
+    benchSink = (int)odometry.getPose().x;
+    updateOdometry();
+    printf("    update(): %.2f ns real on this computer, updateOdometry() %lu us virtual (%.1f%% of the brain at %d ms)\n",
+        elapsed / PROFILE_BENCH_STEPS, (unsigned long)odometryUpdateTime,
+        odometryUpdateTime / (ODOMETRY_PERIOD * 10.0), ODOMETRY_PERIOD);
+}
+
+/*------------------------------------- Moves -------------------------------------*/
+
+/* Keeps the simulated drive moving along with the motors, like the harness does. */
+static void benchDriveUpdater() {
+    while(1) {
+        sim::updateDrive();
+        sim::sleepFor(1000);
+    }
+}
+
+/* Runs one move and prints where the robot really ended up, against where it should have. */
+static void printMove(const char *name, bool reached, uint32_t start, double x, double y, double heading) {
+    sim::TruePose truth = sim::truePose();
+    double off = sqrt((truth.x - x) * (truth.x - x) + (truth.y - y) * (truth.y - y));
+    printf("    %-22s %-8s %5lu ms   at %6.1f %6.1f %6.1f   off %5.2f in %5.2f deg\n", name, reached ? "settled" : "TIMEOUT",
+        (unsigned long)(timer::system() - start), truth.x, truth.y, truth.heading, off, fabs(truth.heading - heading));
+}
+
+/* The same short route each time, from wherever the robot is. */
+static void movesRoute() {
+    sim::setDrive(leftWheelTrainMotor.index(), rightWheelTrainMotor.index());
+    resetOdometry(0, 0, 0);
+    uint32_t start = timer::system();
+    bool reached = driveDistance(24);
+    printMove("driveDistance(24)", reached, start, 0, 24, 0);
+    start = timer::system();
+    reached = turnToHeading(90);
+    printMove("turnToHeading(90)", reached, start, 0, 24, 90 * MIRROR);
+    start = timer::system();
+    reached = driveArc(18, -90);
+    //A quarter circle left, from facing right
+    printMove("driveArc(18, -90)", reached, start, 18, 42, 0);
+    start = timer::system();
+    reached = driveDistance(-12);
+    printMove("driveDistance(-12)", reached, start, 18, 30, 0);
+}
+
+static void movesBench() {
+    printf("autonomous moves on the simulated drive (scrub %.2f), true end positions against the planned ones\n",
+        sim::driveModel.scrub);
+    for(int i = 0; i < NUM_WHEEL_TRAINS; i++) { wheelTrains[i]->setLimits(AUTONOMOUS_LIMITS); }
+    sim::spawn(benchDriveUpdater, task::taskPriorityHigh + 1, "drive");
+    startWheelControl();
+    startOdometry();
+    while(inertialSensor.isCalibrating()) { wait(10, msec); }
+
+    printf("  no load\n");
+    movesRoute();
+
+    printf("  left side 1 V load\n");
+    sim::setMotorLoad(leftWheelTrainMotor.index(), 1);
+    movesRoute();
+    sim::setMotorLoad(leftWheelTrainMotor.index(), 0);
+
+    printf("  wheels held still (timeout)\n");
+    sim::setMotorLoad(leftWheelTrainMotor.index(), 12);
+    sim::setMotorLoad(rightWheelTrainMotor.index(), 12);
+    sim::setDrive(leftWheelTrainMotor.index(), rightWheelTrainMotor.index());
+    resetOdometry(0, 0, 0);
+    uint32_t start = timer::system();
+    bool reached = driveDistance(24, MOVE_SPEED, ExitConditions{0.5, 100, 1000});
+    printMove("driveDistance(24)", reached, start, 0, 24, 0);
+}
+
+/*------------------------------------- Path --------------------------------------*/
+
+/* The ways of driving a route the path bench compares. */
+enum routeDrivers { stopAndTurn, purePursuit, trajectory };
+
+/* How far the robot really is from the path, sampled by pathSampler() while `sampling`. */
+static const Path *sampledPath = nullptr;
+static bool sampling = false;
+static double worstTrackingError, totalTrackingError;
+static int trackingSamples;
+
+/* The distance from a point to the nearest stretch of a path. */
+static double distanceToPath(const Path &path, double x, double y) {
+    double best = INFINITY;
+    for(int i = 0; i < path.getSize() - 1; i++) {
+        double dx = path[i + 1].x - path[i].x, dy = path[i + 1].y - path[i].y;
+        double t = ((x - path[i].x) * dx + (y - path[i].y) * dy) / (dx * dx + dy * dy);
+        t = t < 0 ? 0 : (t > 1 ? 1 : t);
+        best = fmin(best, hypot(path[i].x + t * dx - x, path[i].y + t * dy - y));
+    }
+    return best;
+}
+
+static void pathSampler() {
+    while(1) {
+        if(sampling) {
+            sim::TruePose truth = sim::truePose();
+            double error = distanceToPath(*sampledPath, truth.x, truth.y);
+            worstTrackingError = fmax(worstTrackingError, error);
+            totalTrackingError += error;
+            trackingSamples++;
+        }
+        sim::sleepFor(10000);
+    }
+}
+
+static void printRoute(const char *name, bool reached, uint32_t start, const Path &path) {
+    sim::TruePose truth = sim::truePose();
+    const PathPoint &end = path[path.getSize() - 1];
+    printf("    %-22s %-8s %5lu ms   off the path %5.2f in worst %5.2f in mean   end off %5.2f in\n", name,
+        reached ? "settled" : "TIMEOUT", (unsigned long)(timer::system() - start), worstTrackingError,
+        totalTrackingError / (trackingSamples > 0 ? trackingSamples : 1), hypot(truth.x - end.x, truth.y - end.y));
+}
+
+/*
+ * Drives HOME_ROW (see routes.h): with pure pursuit, along its trajectory
+ * table, or as straight lines with a turn on the spot at each waypoint.
+*/
+static void pathRoute(const Path &path, int driver) {
+    sim::setDrive(leftWheelTrainMotor.index(), rightWheelTrainMotor.index());
+    resetOdometry(0, 0, 0);
+    sampledPath = &path;
+    worstTrackingError = totalTrackingError = 0;
+    trackingSamples = 0;
+    sampling = true;
+    uint32_t start = timer::system();
+    bool reached = true;
+    ExitConditions exit = {PATH_EXIT.tolerance, PATH_EXIT.settleTime, 30000};
+    if(driver == purePursuit) {
+        reached = followPath(path, HOME_ROW.speed, exit);
+    } else if(driver == trajectory) {
+        reached = followTrajectory(homeRowTrajectory, exit);
+    } else {
+        const Waypoint *route = HOME_ROW.waypoints;
+        for(int i = 1; i < HOME_ROW.count; i++) {
+            double dx = route[i].x - route[i - 1].x, dy = route[i].y - route[i - 1].y;
+            reached = turnToHeading(atan2(dx, dy) * 180.0 / M_PI) && reached;
+            reached = driveDistance(hypot(dx, dy)) && reached;
+        }
+    }
+    sampling = false;
+    printRoute(driver == purePursuit ? "pure pursuit" : (driver == trajectory ? "trajectory table" : "stop and turn"),
+        reached, start, path);
+}
+
+static void pathBench() {
+    Path path(HOME_ROW.waypoints, HOME_ROW.count, HOME_ROW.speed);
+    printf("the %.0f in HOME_ROW route through %d waypoints (%d path points, %lu bytes; trajectory %d samples, %lu bytes)"
+        " on the simulated drive\n", path.getLength(), HOME_ROW.count, path.getSize(), (unsigned long)sizeof(path),
+        homeRowTrajectory.size, (unsigned long)(homeRowTrajectory.size * sizeof(TrajectorySample)));
+    for(int i = 0; i < NUM_WHEEL_TRAINS; i++) { wheelTrains[i]->setLimits(AUTONOMOUS_LIMITS); }
+    sim::spawn(benchDriveUpdater, task::taskPriorityHigh + 1, "drive");
+    sim::spawn(pathSampler, task::taskPriorityHigh + 1, "sampler");
+    startWheelControl();
+    startOdometry();
+    while(inertialSensor.isCalibrating()) { wait(10, msec); }
+
+    pathRoute(path, stopAndTurn);
+    pathRoute(path, purePursuit);
+    pathRoute(path, trajectory);
+    sim::setMotorLoad(leftWheelTrainMotor.index(), 1);
+    pathRoute(path, purePursuit);
+    pathRoute(path, trajectory);
+    printf("    (the last two runs have a 1 V load on the left side)\n");
+    sim::setMotorLoad(leftWheelTrainMotor.index(), 0);
+
+    //The cost of one step (real time), with the robot somewhere along the path
+    PurePursuit pursuit(path);
+    Pose pose = {};
+    double left, right, sum = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for(int i = 0; i < PROFILE_BENCH_STEPS; i++) {
+        int along = (i / 1000) % path.getSize();
+        pose.x = path[along].x + 1;
+        pose.y = path[along].y;
+        pose.velocity = 10;
+        if(along == 0) { pursuit.reset(); }
+        sum += pursuit.step(pose, MOVE_SPEED, left, right) + left;
+    }
+    double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    benchSink = (int)sum;
+    printf("    step(): %.2f ns (real time on this computer, no device reads)\n", elapsed / PROFILE_BENCH_STEPS);
+}
+
+/*------------------------------------- Plans -------------------------------------*/
+
+/* Prints when each action of a plan ran. */
+static void printPlan(const ActionPlan &plan, const char *const *names, int count) {
+    for(int i = 0; i < count; i++) {
+        printf("        %-22s %5lu - %5lu ms\n", names[i], (unsigned long)plan.getStartTime(i), (unsigned long)plan.getEndTime(i));
+    }
+}
+
+/*
+ * Picking up a ball on the way to a goal: drive up to it, intake it, turn to
+ * the goal, lift it in and back away. First one step at a time with the
+ * blocking moves (like timedMovement() had to), then as one plan with the
+ * ball handling overlapping the driving.
+*/
+static void planBench() {
+    printf("picking up and scoring a ball, one step at a time and as an action plan\n");
+    for(int i = 0; i < NUM_WHEEL_TRAINS; i++) { wheelTrains[i]->setLimits(AUTONOMOUS_LIMITS); }
+    sim::spawn(benchDriveUpdater, task::taskPriorityHigh + 1, "drive");
+    startWheelControl();
+    startOdometry();
+    while(inertialSensor.isCalibrating()) { wait(10, msec); }
+
+    sim::setDrive(leftWheelTrainMotor.index(), rightWheelTrainMotor.index());
+    resetOdometry(0, 0, 0);
+    uint32_t start = timer::system();
+    driveDistance(24);
+    IntakeAction intakeBall(intake, 1000);
+    runAction(intakeBall);
+    turnToHeading(90);
+    LiftAction liftBall(up, 800);
+    runAction(liftBall);
+    driveDistance(-12);
+    uint32_t oneAtATime = timer::system() - start;
+    sim::TruePose first = sim::truePose();
+    printf("    one at a time   %5lu ms   ends at %6.1f %6.1f %6.1f\n", (unsigned long)oneAtATime, first.x, first.y, first.heading);
+
+    sim::setDrive(leftWheelTrainMotor.index(), rightWheelTrainMotor.index());
+    resetOdometry(0, 0, 0);
+    DriveDistance toBall(24);
+    IntakeAction planIntake(intake, 1000);
+    TurnToHeading toGoal(90);
+    LiftAction planLift(up, 800);
+    DriveDistance backAway(-12);
+    ActionPlan plan;
+    int driving = plan.add(toBall);
+    plan.add(planIntake, startAfterDriving(16)); //Before the robot gets there, so the ball goes straight in
+    int turning = plan.add(toGoal, startAfter(driving));
+    int lifting = plan.add(planLift, startAfter(turning));
+    plan.add(backAway, startAfter(lifting));
+    start = timer::system();
+    bool finished = plan.run();
+    uint32_t planned = timer::system() - start;
+    sim::TruePose second = sim::truePose();
+    printf("    action plan     %5lu ms   ends at %6.1f %6.1f %6.1f   %s, %.0f%% quicker\n", (unsigned long)planned,
+        second.x, second.y, second.heading, finished ? "finished" : "TIMED OUT", 100.0 * (oneAtATime - (double)planned) / oneAtATime);
+    static const char *const PLAN_NAMES[] = {"drive to the ball", "intake (after 16 in)", "turn to the goal", "lift", "back away"};
+    printPlan(plan, PLAN_NAMES, 5);
+}
+
+/*------------------------------------ Commands -----------------------------------*/
+
+/* One step of a button script: wait `after` ms, then press or let go of a button. */
+struct ButtonStep {
+    int after;
+    sim::Button button;
+    bool pressing;
+};
+
+/* The buttons pressed, and what the lift and intake should be doing at the end (the buttons still held). */
+struct ButtonScript {
+    const char *name;
+    const ButtonStep *steps;
+    int count;
+    const char *wantedLift, *wantedIntake;
+};
+
+static const ButtonStep INTAKE_THEN_EXPEL[] = {{0, sim::ButtonR1, true}, {200, sim::ButtonR2, true}, {200, sim::ButtonR1, false}};
+static const ButtonStep EXPEL_THEN_INTAKE[] = {{0, sim::ButtonR2, true}, {200, sim::ButtonR1, true}, {200, sim::ButtonR2, false}};
+static const ButtonStep BOTH_LIFT[] = {{0, sim::ButtonL1, true}, {0, sim::ButtonL2, true}, {200, sim::ButtonL1, false}};
+static const ButtonStep SWAP_BOTH[] = {{0, sim::ButtonL1, true}, {0, sim::ButtonR1, true}, {200, sim::ButtonL2, true},
+    {0, sim::ButtonR2, true}, {10, sim::ButtonL2, false}, {0, sim::ButtonR2, false}};
+
+static const ButtonScript BUTTON_SCRIPTS[] = {
+    {"R1, R2, let go of R1", INTAKE_THEN_EXPEL, 3, "stopped", "expel"},
+    {"R2, R1, let go of R2", EXPEL_THEN_INTAKE, 3, "stopped", "intake"},
+    {"L1+L2, let go of L1", BOTH_LIFT, 3, "down", "stopped"},
+    {"L1+R1, tap L2+R2", SWAP_BOTH, 6, "up", "intake"},
+};
+
+/* @returns const char *   What the motor on `port` was last told to do, named from `names` (forward, reverse, stopped). */
+static const char *motorState(int32_t port, const char *const *names) {
+    const std::vector<sim::MotorCommand> &commands = sim::motorCommands();
+    for(size_t i = commands.size(); i-- > 0;) {
+        const sim::MotorCommand &command = commands[i];
+        if(command.port != port) { continue; }
+        if(command.type == sim::MotorCommandType::stop) { return names[2]; }
+        if(command.type == sim::MotorCommandType::spin) { return names[(int)command.value == (int)directionType::fwd ? 0 : 1]; }
+    }
+    return names[2];
+}
+
+static const char *const LIFT_STATES[] = {"down", "up", "stopped"};
+static const char *const INTAKE_STATES[] = {"intake", "expel", "stopped"};
+
+/* The control loop's part of driver control, without the driving. */
+static void benchCommandLoop() {
+    controlTicker.start();
+    while(1) {
+        applyActuatorCommands();
+        controlTicker.waitForNextTick();
+    }
+}
+
+/*
+ * Overlapping presses of the function buttons. Before the command queue, each
+ * event set the motors itself, so whichever event ran last won ("last event"
+ * below, worked out from the script), like letting go of R1 stopping the
+ * intake while R2 is still held. Then lots of presses and releases landing in
+ * the same tick, for the queue's depth and how long commands wait.
+*/
+static void commandsBench() {
+    printf("overlapping function buttons: last event wins (before), the command queue, and what is held\n");
+    registerActuatorButtons();
+    sim::spawn(benchCommandLoop, task::taskPriorityHigh, "control");
+
+    for(const ButtonScript &script : BUTTON_SCRIPTS) {
+        const char *lastLift = "stopped";
+        const char *lastIntake = "stopped";
+        for(int i = 0; i < script.count; i++) {
+            const ButtonStep &step = script.steps[i];
+            if(step.after > 0) { wait(step.after, msec); }
+            sim::setButton(step.button, step.pressing);
+            bool lift = step.button == sim::ButtonL1 || step.button == sim::ButtonL2;
+            bool first = step.button == sim::ButtonL1 || step.button == sim::ButtonR1; //Up and intake
+            const char *state = !step.pressing ? "stopped" : lift ? (first ? "up" : "down") : (first ? "intake" : "expel");
+            if(lift) { lastLift = state; } else { lastIntake = state; }
+        }
+        wait(2 * TICK_LENGTH, msec);
+
+        const char *lift = motorState(liftTopMotor.index(), LIFT_STATES);
+        const char *intakeState = motorState(intakeLeftMotor.index(), INTAKE_STATES);
+        bool right = strcmp(lift, script.wantedLift) == 0 && strcmp(intakeState, script.wantedIntake) == 0;
+        printf("    %-22s last event %7s/%-7s   queue %7s/%-7s   held %7s/%-7s %s\n", script.name, lastLift, lastIntake,
+            lift, intakeState, script.wantedLift, script.wantedIntake, right ? "" : "  WRONG");
+
+        for(int button = 0; button < sim::NUM_BUTTONS; button++) { sim::setButton((sim::Button)button, false); }
+        wait(2 * TICK_LENGTH, msec);
+    }
+
+    //Every function button pressed at once, then let go at once, a few ms into a tick
+    clearLatencyStats();
+    static const sim::Button FUNCTION_BUTTONS[] = {sim::ButtonL1, sim::ButtonL2, sim::ButtonR1, sim::ButtonR2};
+    for(int round = 0; round < 200; round++) {
+        for(int pressing = 1; pressing >= 0; pressing--) {
+            wait(TICK_LENGTH / 2 + round % 7, msec);
+            for(sim::Button button : FUNCTION_BUTTONS) { sim::setButton(button, pressing); }
+            wait(TICK_LENGTH / 2 - round % 7, msec);
+        }
+    }
+    wait(2 * TICK_LENGTH, msec);
+    printf("    bursts of 4 events: %lu commands, depth p50 %lu max %lu, wait (us) p50 %lu p99 %lu max %lu, dropped %lu\n",
+        (unsigned long)commandLatencyHistogram.count(), (unsigned long)commandDepthHistogram.percentile(50),
+        (unsigned long)commandDepthHistogram.max(), (unsigned long)commandLatencyHistogram.percentile(50),
+        (unsigned long)commandLatencyHistogram.percentile(99), (unsigned long)commandLatencyHistogram.max(),
+        (unsigned long)actuatorQueue.getDropped());
+
+    //The queue on its own, as fast as it goes
+    ActuatorCommand command = {intakeIntent, true, 0};
+    CommandQueue *queue = new CommandQueue();
+    auto start = std::chrono::steady_clock::now();
+    uint32_t popped = 0;
+    for(int i = 0; i < PROFILE_BENCH_STEPS; i++) {
+        queue->push(command);
+        popped += queue->pop(command);
+    }
+    double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    benchSink = (int)popped;
+    printf("    push() + pop(): %.2f ns (real time on this computer)\n", elapsed / PROFILE_BENCH_STEPS);
+    delete queue;
+}
+
+/*--------------------------------- Emergency Stop --------------------------------*/
+
+static const int ESTOP_BENCH_PRESSES = 100;
+
+/* Driver control going flat out: driving forward and intaking, every tick. */
+static void benchDrivingLoop() {
+    controlTicker.start();
+    while(1) {
+        movement(50, 0);
+        intakeMotors(intake);
+        controlTicker.waitForNextTick();
+    }
+}
+
+/*
+ * Presses the emergency stop at different points in the control and wheel
+ * control ticks while the robot is driving, and measures how long it really
+ * took until every motor had been told to stop (from the simulator's motor
+ * command log), next to what the emergency stop task measured itself.
+*/
+static void estopBench() {
+    printf("emergency stop while driving, %d presses\n", ESTOP_BENCH_PRESSES);
+    sim::spawn(benchDriveUpdater, task::taskPriorityHigh + 1, "drive");
+    startWheelControl();
+    startEmergencyStop();
+    sim::spawn(benchDrivingLoop, task::taskPriorityNormal, "control");
+    clearLatencyStats();
+
+    Histogram trueLatency;
+    int spinsWhileHeld = 0, restarted = 0;
+    for(int press = 0; press < ESTOP_BENCH_PRESSES; press++) {
+        wait(600 + (press * 37) % 50, msec); //Up to speed, then somewhere different in the ticks each time
+        size_t first = sim::motorCommands().size();
+        uint64_t pressed = timer::systemHighResolution();
+        sim::setButton(sim::ButtonB, true);
+        wait(300, msec);
+
+        //When each motor was first told to stop, and whether anything started one again while the button was held
+        uint64_t allStopped = 0;
+        const std::vector<sim::MotorCommand> &commands = sim::motorCommands();
+        for(int i = 0; i < NUM_MOTORS; i++) {
+            int32_t port = allMotors[i]->device->index();
+            uint64_t stopped = 0;
+            for(size_t c = first; c < commands.size(); c++) {
+                if(commands[c].port != port) { continue; }
+                if(commands[c].type == sim::MotorCommandType::stop && stopped == 0) { stopped = commands[c].time; }
+                if(commands[c].type != sim::MotorCommandType::stop && stopped != 0) { spinsWhileHeld++; }
+            }
+            if(stopped == 0) { stopped = UINT64_MAX; }
+            if(stopped > allStopped) { allStopped = stopped; }
+        }
+        trueLatency.record(allStopped == UINT64_MAX ? UINT32_MAX : (uint32_t)(allStopped - pressed));
+
+        sim::setButton(sim::ButtonB, false);
+        wait(300, msec);
+        if(rightWheelTrain.getVelocity() > 0 && !isEmergencyStopped()) { restarted++; }
+    }
+
+    printf("    press to every motor stopped (us)   p50 %5lu  p99 %5lu  max %5lu\n", (unsigned long)trueLatency.percentile(50),
+        (unsigned long)trueLatency.percentile(99), (unsigned long)trueLatency.max());
+    printf("    measured by the task (us)           p50 %5lu  p99 %5lu  max %5lu   (limit %d ms, %lu late)\n",
+        (unsigned long)stopLatencyHistogram.percentile(50), (unsigned long)stopLatencyHistogram.percentile(99),
+        (unsigned long)stopLatencyHistogram.max(), EMERGENCY_STOP_LIMIT, (unsigned long)getEmergencyStopsLate());
+    printf("    motors started while held: %d, drove off again after letting go: %d of %d\n", spinsWhileHeld, restarted,
+        ESTOP_BENCH_PRESSES);
+}
+
+/*------------------------------------ Watchdog -----------------------------------*/
+
+/* How long the bench's control loop should block on its next tick (ms), like a slow SD card write. */
+static volatile int benchBlockFor = 0;
+
+/* Driver control driving forward, blocking when told to. */
+static void benchBlockingLoop() {
+    controlTicker.start();
+    while(1) {
+        movement(50, 0);
+        if(benchBlockFor > 0) {
+            int block = benchBlockFor;
+            benchBlockFor = 0;
+            wait(block, msec);
+        }
+        controlTicker.waitForNextTick();
+    }
+}
+
+static double distanceBetween(const sim::TruePose &a, const sim::TruePose &b) { return hypot(b.x - a.x, b.y - a.y); }
+
+/* Blocks the control loop for `ms` once the robot is going, and prints how far it went meanwhile and whether it carried on after. */
+static void blockRun(const char *name, int ms) {
+    sim::setDrive(leftWheelTrainMotor.index(), rightWheelTrainMotor.index());
+    wait(1000, msec); //Up to speed
+    sim::TruePose before = sim::truePose();
+    benchBlockFor = ms;
+    wait(ms + TICK_LENGTH, msec);
+    sim::TruePose after = sim::truePose();
+    wait(1000, msec);
+    sim::TruePose later = sim::truePose();
+    printf("    %-18s blocked %4d ms   drove %5.1f in while blocked   %s after\n", name, ms, distanceBetween(before, after),
+        distanceBetween(after, later) > 1 ? "drove on" : "STOPPED");
+}
+
+static const int WATCHDOG_BENCH_BLOCKS[] = {100, 300, 1000};
+
+/*
+ * The control loop blocking while driving at full speed, without the watchdog
+ * and then with it. Then how quickly the watchdog caught each stall, that a
+ * control loop that ticks on time never trips it, and what a check costs.
+*/
+static void watchdogBench() {
+    printf("control loop blocking while driving, without and with the watchdog (margin %d ms)\n", WATCHDOG_MARGIN);
+    sim::spawn(benchDriveUpdater, task::taskPriorityHigh + 1, "drive");
+    startWheelControl();
+    sim::spawn(benchBlockingLoop, task::taskPriorityNormal, "control");
+    for(int ms : WATCHDOG_BENCH_BLOCKS) { blockRun("no watchdog", ms); }
+
+    clearLatencyStats();
+    startWatchdog();
+    for(int ms : WATCHDOG_BENCH_BLOCKS) { blockRun("watchdog", ms); }
+
+    WatchdogStats stats = getWatchdogStats();
+    printf("    caught %lu stalls, %lu to %lu us after the margin; longest %s %lu ms\n", (unsigned long)stats.stalls,
+        (unsigned long)stallDetectionHistogram.percentile(0), (unsigned long)stallDetectionHistogram.max(),
+        stats.longest.name ? stats.longest.name : "-", (unsigned long)(stats.longest.duration / 1000));
+
+    //Ten seconds of ticking on time
+    uint32_t stallsBefore = stats.stalls;
+    wait(10000, msec);
+    printf("    10 s without blocking: %lu false stalls\n", (unsigned long)(getWatchdogStats().stalls - stallsBefore));
+
+    printf("    check: %lu us virtual (%.2f%% of the brain at %d ms)", (unsigned long)watchdogCheckHistogram.max(),
+        100.0 * watchdogCheckHistogram.max() / (WATCHDOG_PERIOD * 1000), WATCHDOG_PERIOD);
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < PROFILE_BENCH_STEPS / 100; i++) { checkWatchedLoops(); }
+    double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    printf(", %.2f ns real on this computer\n", elapsed / (PROFILE_BENCH_STEPS / 100));
+}
+
+/*------------------------------------ Thermal ------------------------------------*/
+
+static const int THERMAL_BENCH_MINUTES = 15;
+static const double THERMAL_BENCH_START = 36; //A robot that has already been driven for a while
+static const int THERMAL_BENCH_CYCLE = 8000; //ms: pushing, then backing away and driving back
+static const int THERMAL_BENCH_PUSH = 2000; //ms
+static const double THERMAL_BENCH_PUSH_LOAD = 24; //Volts, more than the drive can push
+static const double THERMAL_BENCH_ROLLING_LOAD = 0.5; //Volts
+
+static volatile bool benchDerating = false;
+static volatile int32_t benchStick = 0;
+
+/* Driver control at full stick, with or without updateThermal(). */
+static void benchThermalLoop() {
+    InputFrame input;
+    memset(&input, 0, sizeof(input));
+    controlTicker.start();
+    while(1) {
+        if(benchDerating) { updateThermal(); }
+        input.axes[forwardAxis] = benchStick;
+        movement(input);
+        controlTicker.waitForNextTick();
+    }
+}
+
+/* Writes seconds as m:ss, or "--" if negative. */
+static const char *minutes(char *text, size_t size, double seconds) {
+    if(seconds < 0) { snprintf(text, size, "--"); }
+    else { snprintf(text, size, "%d:%02d", (int)seconds / 60, (int)seconds % 60); }
+    return text;
+}
+
+/*
+ * Pushes another robot that does not give, backs away and drives back into
+ * it, over and over, from already warm. Prints, once a minute, how fast the
+ * drive went in between pushes, how hard it pushed, how hot it really was and
+ * how long the tracker said it had until the firmware throttled it.
+ * @returns double   How far the drive went (wheel turns).
+*/
+static double thermalRun(bool derating) {
+    int32_t port = rightWheelTrainMotor.index();
+    for(int i=0; i<NUM_MOTORS; i++) {
+        int32_t motorPort = allMotors[i]->device->index();
+        sim::setMotorTemperature(motorPort, i < NUM_WHEEL_TRAINS ? THERMAL_BENCH_START : sim::motorModel.ambientTemperature);
+        motorThermals[i] = ThermalTracker();
+    }
+    ThermalTracker watching; //Without derating, so the predictions can still be checked
+    benchDerating = derating;
+
+    printf("    %s\n", derating ? "derating" : "no derating (the firmware throttles)");
+    printf("      min  turns  push A  true temp  read  drive power  throttle in\n");
+    double total = 0, minuteTurns = 0, lastTurns = sim::motorTurns(port), pushCurrent = 0;
+    int pushSamples = 0;
+    double throttledAt = -1, predictions[THERMAL_BENCH_MINUTES];
+    int step = 100;
+    for(int ms = step; ms <= THERMAL_BENCH_MINUTES * 60000; ms += step) {
+        int phase = ms % THERMAL_BENCH_CYCLE;
+        bool pushing = phase < THERMAL_BENCH_PUSH;
+        int sprint = (THERMAL_BENCH_CYCLE - THERMAL_BENCH_PUSH) / 2;
+        for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
+            sim::setMotorLoad(wheelTrains[i]->wheelMotor.device->index(), pushing ? THERMAL_BENCH_PUSH_LOAD : THERMAL_BENCH_ROLLING_LOAD);
+        }
+        benchStick = pushing || phase >= THERMAL_BENCH_PUSH + sprint ? 127 : -127;
+        wait(step, msec);
+
+        double turns = sim::motorTurns(port);
+        minuteTurns += fabs(turns - lastTurns);
+        lastTurns = turns;
+        if(pushing) {
+            pushCurrent += rightWheelTrainMotor.current(amp);
+            pushSamples++;
+        }
+        if(throttledAt < 0 && sim::motorTemperature(port) >= THROTTLE_TEMPERATURE) { throttledAt = ms / 1000.0; }
+        if(!derating && ms % THERMAL_SAMPLE_TIME == 0) { watching.add(rightWheelTrainMotor.temperature(celsius)); }
+
+        if(ms % 60000 == 0) {
+            const ThermalTracker &tracker = derating ? motorThermals[0] : watching;
+            int minute = ms / 60000;
+            predictions[minute - 1] = tracker.secondsToThrottle();
+            char text[16];
+            printf("      %3d  %5.1f  %6.2f  %9.1f  %4.0f  %10.0f%%  %11s\n", minute, minuteTurns, pushCurrent / pushSamples,
+                sim::motorTemperature(port), rightWheelTrainMotor.temperature(celsius), drivePower() * 100,
+                minutes(text, sizeof(text), predictions[minute - 1]));
+            total += minuteTurns;
+            minuteTurns = pushCurrent = 0;
+            pushSamples = 0;
+        }
+    }
+
+    char text[16];
+    printf("      firmware throttled at %s, %.0f wheel turns in all\n", minutes(text, sizeof(text), throttledAt), total);
+    if(!derating && throttledAt > 0) {
+        //How far off each prediction was, from the minutes the motor was heating up towards it
+        double worst = 0;
+        for(int minute = 1; minute * 60 < throttledAt; minute++) {
+            if(predictions[minute - 1] < 0) { continue; }
+            double off = fabs(minute * 60 + predictions[minute - 1] - throttledAt);
+            if(off > worst) { worst = off; }
+        }
+        printf("      predictions before then were up to %.0f s off\n", worst);
+    }
+
+    benchStick = 0;
+    benchDerating = false;
+    for(int i=0; i<NUM_MOTORS; i++) { allMotors[i]->setMaxTorque(100); }
+    wait(2000, msec);
+    return total;
+}
+
+/*
+ * A long practice run of pushing matches, once without derating (full power
+ * until the firmware cuts the drive's current in half) and once with
+ * updateThermal() taking it away gradually instead.
+*/
+static void thermalBench() {
+    printf("pushing for %d of every %d s for %d minutes, from %.0f C\n", THERMAL_BENCH_PUSH / 1000,
+        THERMAL_BENCH_CYCLE / 1000, THERMAL_BENCH_MINUTES, THERMAL_BENCH_START);
+    tractionControl = false; //The pushing is a load on the motors, the simulated robot never moves
+    startWheelControl();
+    sim::spawn(benchThermalLoop, task::taskPriorityNormal, "control");
+    double without = thermalRun(false);
+    double with = thermalRun(true);
+    printf("    derating drove %.0f%% as far\n", 100 * with / without);
+}
+
+/*------------------------------------ Battery ------------------------------------*/
+
+enum batteryBenchModes { rpmCommands, uncompensatedVolts, compensatedVolts, NUM_BATTERY_BENCH_MODES };
+
+static const char *const BATTERY_BENCH_MODES[] = {"rpm commands", "volts, uncompensated", "volts, compensated"};
+
+/* What one run of the battery bench saw (of the right wheel, the left one has a load). */
+struct BatteryRun {
+    double riseTime, steady, turns, lowestVoltage;
+};
+
+/*
+ * Runs both wheel trains from rest to `goal` rpm for two seconds, with the
+ * left one pushing a 1 V load, the way the wheel control task does (reading
+ * the battery every WHEEL_CONTROL_PERIOD), or just asking the motors for the
+ * velocity like before the velocity controllers.
+*/
+static BatteryRun batteryRun(int mode, double charge, int goal) {
+    BatteryRun run = {};
+    for(int i = 0; i < NUM_WHEEL_TRAINS; i++) {
+        wheelTrains[i]->setVelocity(0);
+        wheelTrains[i]->control();
+    }
+    wait(1000, msec);
+    sim::setBatteryCharge(charge);
+    batteryCompensation = mode == compensatedVolts;
+    int32_t leftPort = leftWheelTrain.wheelMotor.device->index();
+    sim::setMotorLoad(leftPort, 1);
+    double startTurns = sim::motorTurns(rightWheelTrainMotor.index());
+    for(int i = 0; i < NUM_WHEEL_TRAINS; i++) { wheelTrains[i]->setGoalVelocity(goal); }
+
+    int steadySamples = 0;
+    run.lowestVoltage = sim::batteryVoltage();
+    for(int time = 0; time < 2000; time += WHEEL_CONTROL_PERIOD) {
+        updateBattery();
+        for(int i = 0; i < NUM_WHEEL_TRAINS; i++) {
+            if(time % TICK_LENGTH == 0) {
+                wheelTrains[i]->updateVelocity();
+                if(mode == rpmCommands) { wheelTrains[i]->spin(forward); }
+            }
+            if(mode != rpmCommands) { wheelTrains[i]->control(); }
+        }
+        double measured = rightWheelTrainMotor.velocity(rpm);
+        if(run.riseTime == 0 && measured >= goal * 0.9) { run.riseTime = time; }
+        if(time >= 1000) {
+            run.steady += measured;
+            steadySamples++;
+        }
+        if(sim::batteryVoltage() < run.lowestVoltage) { run.lowestVoltage = sim::batteryVoltage(); }
+        wait(WHEEL_CONTROL_PERIOD, msec);
+    }
+    run.steady /= steadySamples;
+    run.turns = fabs(sim::motorTurns(rightWheelTrainMotor.index()) - startTurns);
+
+    sim::setMotorLoad(leftPort, 0);
+    batteryCompensation = true;
+    return run;
+}
+
+/*
+ * Half and full stick, each way of driving the wheels, on a full battery and
+ * on a nearly empty one, and how much slower the empty battery made each.
+*/
+static void batteryBench() {
+    const double charges[] = {1, 0.05};
+    const int goals[] = {25, 50};
+    printf("0 to half and full stick for 2 s, full battery against nearly empty (%.0f%%), left wheel pushing 1 V\n",
+        charges[1] * 100);
+    tractionControl = false; //The wheels spin against loads, not the floor, so every start would look like a slip
+    for(int goal : goals) {
+        printf("  %d rpm\n", goal);
+        for(int mode = 0; mode < NUM_BATTERY_BENCH_MODES; mode++) {
+            BatteryRun runs[2];
+            for(int c = 0; c < 2; c++) { runs[c] = batteryRun(mode, charges[c], goal); }
+            printf("    %-21s rise %4.0f/%4.0f ms  steady %4.1f/%4.1f rpm  lowest %5.2f/%5.2f V   %4.1f%% less far\n",
+                BATTERY_BENCH_MODES[mode], runs[0].riseTime, runs[1].riseTime, runs[0].steady, runs[1].steady,
+                runs[0].lowestVoltage, runs[1].lowestVoltage, 100 * (1 - runs[1].turns / runs[0].turns));
+        }
+    }
+    sim::setBatteryCharge(1);
+}
+
+/*------------------------------------ Traction -----------------------------------*/
+
+static const int TRACTION_BENCH_SPRINTS = 6;
+static const int TRACTION_BENCH_SPRINT = 1500; //ms each way
+static const double DUSTY_TRACTION = 30; //inches/s^2, less than DRIVER_LIMITS asks for
+
+/* What one run of the traction bench saw, for both wheel trains. */
+struct TractionRun {
+    /* Slips the robot counted, and slips that really started in the simulator (and how many it caught). */
+    long slips, trueSlips, caught;
+    /* How long after a slip really started the robot caught it (ms). */
+    double latencySum, latencyMax;
+    /* How long either wheel really slipped (ms). */
+    long slipping;
+    /* How far the robot really went, and how far the wheels turned (inches, there and back). */
+    double distance, wheelDistance;
+};
+
+/*
+ * Full stick forward and then back, TRACTION_BENCH_SPRINTS times, and then
+ * stopping, on a floor with `traction`, watching the simulator for every slip
+ * that really starts and how long the robot takes to catch it.
+*/
+static TractionRun tractionRun(ProfileLimits limits, double traction, bool control) {
+    TractionRun run = {};
+    sim::driveModel.traction = traction;
+    tractionControl = control;
+    long slipsBefore = 0;
+    for(int i = 0; i < NUM_WHEEL_TRAINS; i++) {
+        wheelTrains[i]->setLimits(limits);
+        wheelTrains[i]->getTraction().forgetFloor(); //Every run starts out not knowing the floor
+        slipsBefore += wheelTrains[i]->getTraction().getSlips();
+    }
+    sim::setDrive(leftWheelTrainMotor.index(), rightWheelTrainMotor.index());
+
+    bool wasSlipping[NUM_WHEEL_TRAINS] = {}, waiting[NUM_WHEEL_TRAINS] = {};
+    int started[NUM_WHEEL_TRAINS] = {};
+    double lastTurns[NUM_WHEEL_TRAINS];
+    for(int i = 0; i < NUM_WHEEL_TRAINS; i++) { lastTurns[i] = sim::motorTurns(wheelTrains[i]->wheelMotor.device->index()); }
+    double lastY = sim::truePose().y;
+    //Each sprint with the stick held, then one more with it let go, since stopping can slip too
+    for(int ms = 0; ms < (TRACTION_BENCH_SPRINTS * 2 + 1) * TRACTION_BENCH_SPRINT; ms++) {
+        int sprint = ms / TRACTION_BENCH_SPRINT;
+        benchStick = sprint == TRACTION_BENCH_SPRINTS * 2 ? 0 : (sprint % 2 == 0 ? 127 : -127);
+        wait(1, msec);
+
+        bool anySlipping = false;
+        for(int i = 0; i < NUM_WHEEL_TRAINS; i++) {
+            int32_t port = wheelTrains[i]->wheelMotor.device->index();
+            bool slipping = sim::wheelSlipping(port);
+            anySlipping |= slipping;
+            if(slipping && !wasSlipping[i]) {
+                run.trueSlips++;
+                started[i] = ms;
+                waiting[i] = true;
+            }
+            wasSlipping[i] = slipping;
+            if(waiting[i] && wheelTrains[i]->getTraction().isSlipping()) {
+                double latency = ms - started[i];
+                run.latencySum += latency;
+                if(latency > run.latencyMax) { run.latencyMax = latency; }
+                run.caught++;
+                waiting[i] = false;
+            }
+
+            double turns = sim::motorTurns(port);
+            run.wheelDistance += fabs(turns - lastTurns[i]) * sim::driveModel.wheelDiameter * M_PI / NUM_WHEEL_TRAINS;
+            lastTurns[i] = turns;
+        }
+        if(anySlipping) { run.slipping++; }
+        double y = sim::truePose().y;
+        run.distance += fabs(y - lastY);
+        lastY = y;
+    }
+
+    for(int i = 0; i < NUM_WHEEL_TRAINS; i++) { run.slips += wheelTrains[i]->getTraction().getSlips(); }
+    run.slips -= slipsBefore;
+    return run;
+}
+
+static void printTractionRun(const char *name, const TractionRun &run) {
+    printf("    %-20s %4ld slips (%4ld real, %4ld caught in %4.1f ms avg %3.0f max)  slipping %5ld ms  "
+        "went %6.1f in, wheels %6.1f in\n", name, run.slips, run.trueSlips, run.caught,
+        run.caught > 0 ? run.latencySum / run.caught : 0.0, run.latencyMax, run.slipping, run.distance, run.wheelDistance);
+}
+
+/*
+ * Sprints back and forth on a normal floor and on a dusty one where even
+ * DRIVER_LIMITS asks for more than the floor can give, with and without the
+ * motion profile, each with and without traction control holding slipping
+ * wheels back.
+*/
+static void tractionBench() {
+    printf("full stick forward and back %d times (%d ms each way), slips the robot caught against the simulator's\n",
+        TRACTION_BENCH_SPRINTS, TRACTION_BENCH_SPRINT);
+    sim::spawn(benchDriveUpdater, task::taskPriorityHigh + 1, "drive");
+    startWheelControl();
+    inertialSensor.calibrate();
+    while(inertialSensor.isCalibrating()) { wait(10, msec); }
+    sim::spawn(benchThermalLoop, task::taskPriorityNormal, "control");
+
+    double normal = sim::driveModel.traction;
+    const ProfileLimits noProfile = {100000, 0}; //Straight to the goal velocity in one tick
+    struct { const char *name; ProfileLimits limits; double traction; } floors[] = {
+        {"normal floor, DRIVER_LIMITS", DRIVER_LIMITS, normal},
+        {"normal floor, no profile", noProfile, normal},
+        {"dusty floor, DRIVER_LIMITS", DRIVER_LIMITS, DUSTY_TRACTION},
+        {"dusty floor, no profile", noProfile, DUSTY_TRACTION},
+    };
+    for(const auto &floor : floors) {
+        printf("  %s (%.0f in/s^2)\n", floor.name, floor.traction);
+        printTractionRun("no traction control", tractionRun(floor.limits, floor.traction, false));
+        printTractionRun("traction control", tractionRun(floor.limits, floor.traction, true));
+    }
+    sim::driveModel.traction = normal;
+    tractionControl = true;
+    for(int i = 0; i < NUM_WHEEL_TRAINS; i++) { wheelTrains[i]->setLimits(DRIVER_LIMITS); }
+}
+
+/*------------------------------------ Indexer ------------------------------------*/
+
+static const int INDEXER_BENCH_FEED_GAP = 1500; //ms between balls, driving from one to the next
+static const int INDEXER_BENCH_LIFT_TAPS[] = {600, 1200}; //ms the driver without the indexer holds the lift for after each ball
+static const int INDEXER_BENCH_SCORE = 2500; //ms the lift button is held at the goal
+static const int INDEXER_BENCH_CYCLING = 10000; //ms of cycling balls through at a goal
+static const int INDEXER_BENCH_BRING_DOWN = 1500; //ms the lift is held down, on its own and then while expelling
+
+/* Keeps the simulated balls moving along with the intake and lift, like the drive updater. */
+static void benchBallUpdater() {
+    while(1) {
+        sim::updateBalls();
+        sim::sleepFor(1000);
+    }
+}
+
+/* What one run of the indexer bench saw. */
+struct IndexerRun {
+    /* Balls in the robot on reaching the goal, and scored before it (wasted). */
+    int held, early;
+    bool topReady;
+    /* Scored at the goal, how long after pressing the lift the first and last went (ms). */
+    int scored, first, last;
+};
+
+/* Presses or lets go of a button, and waits `ms`, counting the balls scored while waiting. */
+static void benchHold(sim::Button button, bool pressing, int ms, IndexerRun &run, int start) {
+    sim::setButton(button, pressing);
+    for(int i = 0; i < ms; i++) {
+        int before = sim::ballsScored();
+        wait(1, msec);
+        if(sim::ballsScored() > before) {
+            if(run.scored == 0) { run.first = (int)timer::system() - start; }
+            run.last = (int)timer::system() - start;
+            run.scored += sim::ballsScored() - before;
+        }
+    }
+}
+
+/*
+ * Picks up MAX_BALLS balls, INDEXER_BENCH_FEED_GAP apart, holding the intake
+ * button, then scores them all at a goal by holding the lift button for
+ * INDEXER_BENCH_SCORE. Without the indexer (a `liftTap`), the driver also
+ * holds the lift for that long (ms) after each ball to bring it up.
+*/
+static IndexerRun indexerRun(int liftTap) {
+    IndexerRun run = {};
+    bool indexing = liftTap == 0;
+    ballIndexing = indexing;
+    resetIndexer();
+    sim::setIndexer(intakeRightMotor.index(), liftTopMotor.index(), mouthSensor.index(), topSensor.index());
+
+    sim::setButton(sim::ButtonR1, true);
+    for(int ball = 0; ball < MAX_BALLS; ball++) {
+        sim::feedBall();
+        if(indexing) {
+            wait(INDEXER_BENCH_FEED_GAP, msec);
+        } else {
+            benchHold(sim::ButtonL1, true, liftTap, run, 0);
+            benchHold(sim::ButtonL1, false, INDEXER_BENCH_FEED_GAP - liftTap, run, 0);
+        }
+    }
+    wait(INDEXER_BENCH_FEED_GAP, msec);
+    run.early = sim::ballsScored();
+    run.held = sim::ballsInRobot();
+    run.topReady = run.held > 0 && fabs(sim::ballPosition(0) - sim::ballModel.topSensor) < sim::ballModel.sensorReach;
+
+    int start = (int)timer::system();
+    run.scored = 0;
+    benchHold(sim::ButtonL1, true, INDEXER_BENCH_SCORE, run, start);
+    benchHold(sim::ButtonL1, false, 0, run, start);
+    sim::setButton(sim::ButtonR1, false);
+    wait(1000, msec);
+    return run;
+}
+
+/* Holds the lift and intake buttons at a goal, with a ball fed whenever the mouth is free, and returns the balls scored. */
+static int cyclingRun(bool indexing) {
+    ballIndexing = indexing;
+    resetIndexer();
+    sim::setIndexer(intakeRightMotor.index(), liftTopMotor.index(), mouthSensor.index(), topSensor.index());
+    sim::setButton(sim::ButtonR1, true);
+    sim::setButton(sim::ButtonL1, true);
+    for(int ms = 0; ms < INDEXER_BENCH_CYCLING; ms++) {
+        sim::feedBall();
+        wait(1, msec);
+    }
+    sim::setButton(sim::ButtonR1, false);
+    sim::setButton(sim::ButtonL1, false);
+    wait(1000, msec);
+    return sim::ballsScored();
+}
+
+/* What one run of bringing the balls down saw. */
+struct BringDownRun {
+    /* How far the intake turned in while only the lift was held down (turns), and where the lowest ball got to (inches). */
+    double intakeIn, lowest;
+    /* How long after expelling too the lowest ball was back at the mouth (ms, -1 if never), and whether the indexer saw it there. */
+    int atMouth;
+    bool seen;
+};
+
+/*
+ * Picks up MAX_BALLS balls with the indexer, then brings them down to get out
+ * of a jam: the lift held down on its own for INDEXER_BENCH_BRING_DOWN, then
+ * with expel held too until the lowest ball is back at the mouth.
+*/
+static BringDownRun bringDownRun() {
+    BringDownRun run = {};
+    ballIndexing = true;
+    resetIndexer();
+    sim::setIndexer(intakeRightMotor.index(), liftTopMotor.index(), mouthSensor.index(), topSensor.index());
+    sim::setButton(sim::ButtonR1, true);
+    for(int ball = 0; ball < MAX_BALLS; ball++) {
+        sim::feedBall();
+        wait(INDEXER_BENCH_FEED_GAP, msec);
+    }
+    wait(INDEXER_BENCH_FEED_GAP, msec);
+    sim::setButton(sim::ButtonR1, false);
+
+    double intakeBefore = sim::motorTurns(intakeRightMotor.index());
+    sim::setButton(sim::ButtonL2, true);
+    wait(INDEXER_BENCH_BRING_DOWN, msec);
+    run.intakeIn = (sim::motorTurns(intakeRightMotor.index()) - intakeBefore) * sim::ballModel.intakeDirection;
+    run.lowest = sim::ballPosition(sim::ballsInRobot() - 1);
+
+    sim::setButton(sim::ButtonR2, true);
+    run.atMouth = -1;
+    for(int ms = 0; ms < INDEXER_BENCH_BRING_DOWN; ms++) {
+        wait(1, msec);
+        if(sim::ballsInRobot() > 0 && fabs(sim::ballPosition(sim::ballsInRobot() - 1)) < sim::ballModel.sensorReach) {
+            run.atMouth = ms;
+            break;
+        }
+    }
+    sim::setButton(sim::ButtonR2, false);
+    sim::setButton(sim::ButtonL2, false);
+    wait(TICK_LENGTH * 2, msec); //For the control loop to see it
+    IndexerStats stats = getIndexerStats();
+    run.seen = stats.balls > 0 && stats.stages[stats.balls - 1] == mouthStage;
+    return run;
+}
+
+/* Prints what the indexer counted, against what really happened. */
+static void printIndexerStats(int held) {
+    IndexerStats stats = getIndexerStats();
+    printf("        indexer: %d held (really %d), %lu collected, %lu scored, %.2f balls/s, held mouth %.0f lift %.0f top %.0f ms\n",
+        stats.balls, held, (unsigned long)stats.collected, (unsigned long)stats.scored, stats.ballsPerSecond,
+        stats.stageTimes[mouthStage], stats.stageTimes[liftStage], stats.stageTimes[topStage]);
+}
+
+/* Runs indexerRun() and prints what it saw. */
+static void printIndexerRun(int liftTap) {
+    IndexerRun run = indexerRun(liftTap);
+    char name[32];
+    snprintf(name, sizeof(name), liftTap == 0 ? "indexer" : "L1 for %d ms a ball", liftTap);
+    printf("    %-20s at the goal %d held (%s at the top), %d scored early   scored %d, first after %4d ms, last %4d ms\n",
+        name, run.held, run.topReady ? "one" : "none", run.early, run.scored, run.first, run.last);
+    printIndexerStats(sim::ballsInRobot());
+}
+
+/*
+ * Collecting balls and scoring them at a goal with the lift timed by the
+ * driver against the indexer, then cycling balls straight through.
+*/
+static void indexerBench() {
+    printf("pick up %d balls %d ms apart holding R1, then hold L1 at the goal for %d ms\n", MAX_BALLS,
+        INDEXER_BENCH_FEED_GAP, INDEXER_BENCH_SCORE);
+    //The speeds vexcodeInit() gives them, without starting everything else
+    CachedMotor *functionMotors[] = {&intakeLeft, &intakeRight, &liftTop, &liftBottom};
+    for(CachedMotor *functionMotor : functionMotors) { functionMotor->setVelocity(100, velocityUnits::pct); }
+    registerActuatorButtons();
+    sim::spawn(benchBallUpdater, task::taskPriorityHigh + 1, "balls");
+    sim::spawn(benchCommandLoop, task::taskPriorityHigh, "control");
+
+    for(int tap : INDEXER_BENCH_LIFT_TAPS) { printIndexerRun(tap); }
+    printIndexerRun(0);
+    printf("  L1+R1 held for %d ms at a goal, a ball fed whenever the mouth is free\n", INDEXER_BENCH_CYCLING);
+    for(int indexing = 0; indexing <= 1; indexing++) {
+        int scored = cyclingRun(indexing);
+        printf("    %-20s scored %d, %.2f balls/s\n", indexing ? "indexer" : "no indexer", scored,
+            scored * 1000.0 / INDEXER_BENCH_CYCLING);
+        printIndexerStats(sim::ballsInRobot());
+    }
+    printf("  %d balls picked up, then L2 held for %d ms, then L2+R2 until the lowest is back at the mouth\n", MAX_BALLS,
+        INDEXER_BENCH_BRING_DOWN);
+    BringDownRun down = bringDownRun();
+    printf("    indexer              L2: intake turned in %.2f turns, lowest ball at %.1f in   L2+R2: at the mouth after %d ms (%s)\n",
+        down.intakeIn, down.lowest, down.atMouth, down.seen ? "seen there" : "not seen there");
+    printIndexerStats(sim::ballsInRobot());
+    ballIndexing = true;
+}
+
+/*------------------------------------ Runner -------------------------------------*/
+
+struct Benchmark {
+    const char *name;
+    void (*run)(void);
+};
+
+static const Benchmark BENCHMARKS[] = {
+    {"screen", screenBench},
+    {"telemetry", telemetryBench},
+    {"sticks", sticksBench},
+    {"profile", profileBench},
+    {"wheels", wheelsBench},
+    {"odometry", odometryBench},
+    {"moves", movesBench},
+    {"path", pathBench},
+    {"plan", planBench},
+    {"commands", commandsBench},
+    {"estop", estopBench},
+    {"watchdog", watchdogBench},
+    {"thermal", thermalBench},
+    {"battery", batteryBench},
+    {"traction", tractionBench},
+    {"indexer", indexerBench},
+};
+
+static void (*chosenBenchmark)(void) = nullptr;
+
+/* Runs the chosen benchmark, then stops any background tasks it started (like wheel control). */
+static void benchmarkTask() {
+    chosenBenchmark();
+    sim::stopAll();
+}
+
+int runBenchmark(const char *name) {
+    for(const Benchmark &benchmark : BENCHMARKS) {
+        if(strcmp(benchmark.name, name) == 0) {
+            chosenBenchmark = benchmark.run;
+            sim::spawn(benchmarkTask, task::taskPriorityNormal, benchmark.name);
+            sim::run(UINT64_MAX);
+            return 0;
+        }
+    }
+    fprintf(stderr, "controls-sim: unknown benchmark '%s', expected one of:", name);
+    for(const Benchmark &benchmark : BENCHMARKS) { fprintf(stderr, " %s", benchmark.name); }
+    fprintf(stderr, "\n");
+    return 1;
+}
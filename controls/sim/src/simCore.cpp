@@ -0,0 +1,201 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       simCore.cpp                                                     */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Simulator Virtual Clock And Cooperative Task Scheduler          */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <ucontext.h>
+
+namespace sim {
+
+CostModel costs;
+
+/* Each task runs on its own stack and gives control back to the scheduler
+ * (which runs on the host's main stack) when it sleeps, yields or returns. */
+struct Task {
+    int id;
+    const char *name;
+    int32_t priority;
+    int (*intCallback)(void);
+    void (*voidCallback)(void);
+
+    ucontext_t context;
+    char *stack;
+
+    /* The virtual time the task is allowed to run again. */
+    uint64_t wakeTime;
+    /* Used for round robin between tasks of the same priority. */
+    uint64_t lastRun;
+    bool finished;
+};
+
+static const size_t TASK_STACK_SIZE = 256 * 1024;
+
+static uint64_t clock = 0;
+static uint64_t runCount = 0;
+static int nextTaskId = 1;
+static std::vector<Task *> tasks;
+static Task *running = nullptr;
+static ucontext_t schedulerContext;
+static bool autonomous = false;
+
+uint64_t now() { return clock; }
+
+void charge(uint32_t us) { clock += us; }
+
+void setAutonomousPeriod(bool value) { autonomous = value; }
+bool autonomousPeriod() { return autonomous; }
+
+/* makecontext() can only pass int arguments, so the task being started is
+ * passed through here instead. */
+static Task *starting = nullptr;
+
+static void taskEntry() {
+    Task *task = starting;
+    if(task->intCallback) {
+        task->intCallback();
+    } else {
+        task->voidCallback();
+    }
+    task->finished = true;
+    //Returning switches to uc_link (the scheduler)
+}
+
+static int create(int (*intCallback)(void), void (*voidCallback)(void), int32_t priority, const char *name) {
+    Task *task = new Task();
+    task->id = nextTaskId++;
+    task->name = name;
+    task->priority = priority;
+    task->intCallback = intCallback;
+    task->voidCallback = voidCallback;
+    task->stack = (char *)malloc(TASK_STACK_SIZE);
+    task->wakeTime = clock;
+    task->lastRun = 0;
+    task->finished = false;
+
+    getcontext(&task->context);
+    task->context.uc_stack.ss_sp = task->stack;
+    task->context.uc_stack.ss_size = TASK_STACK_SIZE;
+    task->context.uc_link = &schedulerContext;
+    makecontext(&task->context, taskEntry, 0);
+
+    tasks.push_back(task);
+    return task->id;
+}
+
+int spawn(int (*callback)(void), int32_t priority, const char *name) {
+    return create(callback, nullptr, priority, name);
+}
+
+int spawn(void (*callback)(void), int32_t priority, const char *name) {
+    return create(nullptr, callback, priority, name);
+}
+
+static Task *find(int id) {
+    for(Task *task : tasks) {
+        if(task->id == id) { return task; }
+    }
+    return nullptr;
+}
+
+/* Gives control back to the scheduler. Must be called from a task. */
+static void suspend() {
+    if(running == nullptr) {
+        fprintf(stderr, "sim: a task function was called outside of a task\n");
+        abort();
+    }
+    Task *task = running;
+    swapcontext(&task->context, &schedulerContext);
+}
+
+void sleepFor(uint64_t us) { sleepUntil(clock + us); }
+
+void sleepUntil(uint64_t time) {
+    running->wakeTime = time > clock ? time : clock;
+    suspend();
+}
+
+void yield() { sleepUntil(clock); }
+
+bool stopTask(int id) {
+    Task *task = find(id);
+    if(task == nullptr || task->finished) { return false; }
+    task->finished = true;
+    if(task == running) { suspend(); }
+    return true;
+}
+
+void stopAll() {
+    for(Task *task : tasks) { task->finished = true; }
+    if(running) { suspend(); }
+}
+
+int currentTask() { return running ? running->id : 0; }
+
+int32_t taskPriority(int id) {
+    Task *task = find(id);
+    return task ? task->priority : 0;
+}
+
+void setTaskPriority(int id, int32_t priority) {
+    Task *task = find(id);
+    if(task) { task->priority = priority; }
+}
+
+/* Frees tasks that have finished (never the running one). */
+static void reap() {
+    for(size_t i = 0; i < tasks.size();) {
+        if(tasks[i]->finished && tasks[i] != running) {
+            free(tasks[i]->stack);
+            delete tasks[i];
+            tasks.erase(tasks.begin() + i);
+        } else {
+            i++;
+        }
+    }
+}
+
+void run(uint64_t until) {
+    while(true) {
+        reap();
+        if(tasks.empty() || clock > until) { return; }
+
+        //The next time anything can happen
+        uint64_t next = UINT64_MAX;
+        for(Task *task : tasks) {
+            if(task->wakeTime < next) { next = task->wakeTime; }
+        }
+        if(next > clock) {
+            if(next > until) {
+                clock = until;
+                return;
+            }
+            clock = next;
+        }
+
+        //Highest priority ready task, round robin within a priority
+        Task *chosen = nullptr;
+        for(Task *task : tasks) {
+            if(task->finished || task->wakeTime > clock) { continue; }
+            if(chosen == nullptr || task->priority > chosen->priority
+                    || (task->priority == chosen->priority && task->lastRun < chosen->lastRun)) {
+                chosen = task;
+            }
+        }
+
+        chosen->lastRun = ++runCount;
+        running = chosen;
+        starting = chosen;
+        swapcontext(&schedulerContext, &chosen->context);
+        running = nullptr;
+    }
+}
+
+}
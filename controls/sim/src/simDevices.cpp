@@ -0,0 +1,868 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       simDevices.cpp                                                  */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Simulator Stand-in For The V5 SDK Classes                       */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "v5_vcs.h"
+
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+/*---------------------------------- Simulator ------------------------------------*/
+
+namespace sim {
+
+static int32_t axes[5] = {0, 0, 0, 0, 0};
+static bool buttons[NUM_BUTTONS] = {};
+static std::vector<void (*)(void)> pressedCallbacks[NUM_BUTTONS];
+static std::vector<void (*)(void)> releasedCallbacks[NUM_BUTTONS];
+
+static const char *BUTTON_NAMES[NUM_BUTTONS] = {
+    "L1", "L2", "R1", "R2", "Up", "Down", "Left", "Right", "X", "B", "Y", "A"
+};
+
+void setAxis(int axis, int32_t value) {
+    if(axis >= 1 && axis <= 4) { axes[axis] = value; }
+}
+
+void setButton(Button button, bool pressing) {
+    if(button < 0 || button >= NUM_BUTTONS || buttons[button] == pressing) { return; }
+    buttons[button] = pressing;
+    std::vector<void (*)(void)> &callbacks = pressing ? pressedCallbacks[button] : releasedCallbacks[button];
+    for(void (*callback)(void) : callbacks) {
+        spawn(callback, vex::task::taskPriorityNormal, "event");
+    }
+}
+
+Button buttonFromName(const char *name) {
+    for(int i = 0; i < NUM_BUTTONS; i++) {
+        if(strcmp(BUTTON_NAMES[i], name) == 0) { return (Button)i; }
+    }
+    return NUM_BUTTONS;
+}
+
+static std::vector<MotorCommand> commands;
+
+const std::vector<MotorCommand> &motorCommands() { return commands; }
+
+void recordMotorCommand(int32_t port, MotorCommandType type, double value, int32_t unit) {
+    charge(costs.motorCommand);
+    MotorCommand command = {now(), port, type, value, unit};
+    commands.push_back(command);
+}
+
+MotorModel motorModel;
+
+double thermalThrottle(double celsius) {
+    if(celsius >= 70) { return 0; }
+    if(celsius >= 65) { return 0.125; }
+    if(celsius >= 60) { return 0.25; }
+    if(celsius >= 55) { return 0.5; }
+    return 1;
+}
+
+BatteryModel batteryModel;
+
+static double batteryUsed = 0; //Amp seconds
+static double drawing[V5_MAX_DEVICE_PORTS] = {}; //Amps, as of each motor's last step
+
+void setBatteryCharge(double fraction) {
+    batteryUsed = (1 - fraction) * batteryModel.capacity * 3600;
+}
+
+double batteryCharge() {
+    double charge = 1 - batteryUsed / (batteryModel.capacity * 3600);
+    return charge < 0 ? 0 : charge;
+}
+
+double batteryVoltage() {
+    double amps = 0;
+    for(int32_t port = 0; port < V5_MAX_DEVICE_PORTS; port++) { amps += drawing[port]; }
+    const BatteryModel &model = batteryModel;
+    return model.emptyVoltage + (model.fullVoltage - model.emptyVoltage) * batteryCharge() - model.resistance * amps;
+}
+
+void drawCurrent(int32_t port, double amps, double dt) {
+    if(port < 0 || port >= V5_MAX_DEVICE_PORTS) { return; }
+    drawing[port] = amps;
+    batteryUsed += amps * dt;
+}
+
+static double loads[V5_MAX_DEVICE_PORTS] = {};
+
+void setMotorLoad(int32_t port, double volts) {
+    if(port >= 0 && port < V5_MAX_DEVICE_PORTS) { loads[port] = volts; }
+}
+
+double motorLoad(int32_t port) {
+    return port >= 0 && port < V5_MAX_DEVICE_PORTS ? loads[port] : 0;
+}
+
+const char *motorCommandName(MotorCommandType type) {
+    switch(type) {
+        case MotorCommandType::setVelocity: return "setVelocity";
+        case MotorCommandType::setStopping: return "setStopping";
+        case MotorCommandType::spin: return "spin";
+        case MotorCommandType::spinVelocity: return "spinVelocity";
+        case MotorCommandType::spinVoltage: return "spinVoltage";
+        case MotorCommandType::stop: return "stop";
+        case MotorCommandType::setMaxTorque: return "setMaxTorque";
+    }
+    return "?";
+}
+
+static const char *sdPath = nullptr;
+
+void setSdDirectory(const char *path) { sdPath = path; }
+const char *sdDirectory() { return sdPath; }
+
+static ScreenStats stats;
+static char screen[SCREEN_ROWS][SCREEN_COLUMNS + 1];
+
+ScreenStats &screenStats() { return stats; }
+
+const char *screenRow(int row) {
+    if(row < 0 || row >= SCREEN_ROWS) { return ""; }
+    return screen[row];
+}
+
+}
+
+namespace vex {
+
+/*------------------------------------ Time ---------------------------------------*/
+
+static uint64_t toMicroseconds(double time, timeUnits units) {
+    if(time <= 0) { return 0; }
+    return (uint64_t)(units == timeUnits::sec ? time * 1000000.0 : time * 1000.0);
+}
+
+void wait(double time, timeUnits units) { sim::sleepFor(toMicroseconds(time, units)); }
+
+timer::timer() { start = sim::now(); }
+uint32_t timer::time() { return (uint32_t)((sim::now() - start) / 1000); }
+double timer::time(timeUnits units) {
+    double us = (double)(sim::now() - start);
+    return units == timeUnits::sec ? us / 1000000.0 : us / 1000.0;
+}
+void timer::clear() { start = sim::now(); }
+double timer::value() { return time(timeUnits::sec); }
+uint32_t timer::system() { return (uint32_t)(sim::now() / 1000); }
+uint64_t timer::systemHighResolution() { return sim::now(); }
+
+/*------------------------------------ Tasks --------------------------------------*/
+
+task::task() : id(0) {}
+task::task(int (*callback)(void)) : id(sim::spawn(callback, taskPriorityNormal, "task")) {}
+task::task(int (*callback)(void), int32_t priority) : id(sim::spawn(callback, priority, "task")) {}
+
+bool task::stop() { return sim::stopTask(id); }
+int32_t task::priority() { return sim::taskPriority(id); }
+void task::setPriority(int32_t priority) { sim::setTaskPriority(id, priority); }
+void task::sleep(uint32_t time) { sim::sleepFor((uint64_t)time * 1000); }
+void task::yield() { sim::yield(); }
+
+namespace this_thread {
+    int32_t get_id() { return sim::currentTask(); }
+    void yield() { sim::yield(); }
+    void sleep_for(uint32_t time) { sim::sleepFor((uint64_t)time * 1000); }
+    void sleep_until(uint64_t time) { sim::sleepUntil(time * 1000); }
+    int32_t priority() { return sim::taskPriority(sim::currentTask()); }
+    void setPriority(int32_t priority) { sim::setTaskPriority(sim::currentTask(), priority); }
+}
+
+void mutex::lock() {
+    while(owner != 0 && owner != sim::currentTask()) { sim::yield(); }
+    owner = sim::currentTask();
+}
+
+bool mutex::try_lock() {
+    if(owner != 0 && owner != sim::currentTask()) { return false; }
+    owner = sim::currentTask();
+    return true;
+}
+
+void mutex::unlock() { owner = 0; }
+
+/*------------------------------------ Screen -------------------------------------*/
+
+void brain::lcd::write(const char *text) {
+    sim::charge(sim::costs.screenPrint);
+    sim::screenStats().prints++;
+    for(const char *c = text; *c != '\0'; c++) {
+        if(*c == '\n') {
+            cursorRow++;
+            cursorColumn = 0;
+            continue;
+        }
+        if(cursorRow >= 0 && cursorRow < sim::SCREEN_ROWS
+                && cursorColumn >= 0 && cursorColumn < sim::SCREEN_COLUMNS) {
+            char *row = sim::screen[cursorRow];
+            //Rows are kept NUL terminated, padding any gap with spaces
+            int length = (int)strlen(row);
+            for(int i = length; i < cursorColumn; i++) { row[i] = ' '; }
+            row[cursorColumn] = *c;
+            if(cursorColumn >= length) { row[cursorColumn + 1] = '\0'; }
+        }
+        cursorColumn++;
+    }
+}
+
+void brain::lcd::print(const char *format, ...) {
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    write(text);
+}
+
+void brain::lcd::printAt(int32_t x, int32_t y, const char *format, ...) {
+    //The default font is 10 pixels wide, and text is drawn above its baseline
+    cursorColumn = (x + originX) / 10;
+    cursorRow = (y + originY) / 20 - 1;
+    char text[256];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    write(text);
+}
+
+void brain::lcd::printValue(int32_t value) { print("%ld", (long)value); }
+void brain::lcd::printValue(uint32_t value) { print("%lu", (unsigned long)value); }
+void brain::lcd::printValue(long value) { print("%ld", value); }
+void brain::lcd::printValue(unsigned long value) { print("%lu", value); }
+void brain::lcd::printValue(long long value) { print("%lld", value); }
+void brain::lcd::printValue(unsigned long long value) { print("%llu", value); }
+void brain::lcd::printValue(double value) { print("%.2f", value); }
+
+void brain::lcd::setCursor(int32_t row, int32_t col) {
+    sim::screenStats().cursorMoves++;
+    cursorRow = row - 1;
+    cursorColumn = col - 1;
+}
+
+void brain::lcd::newLine() {
+    sim::screenStats().cursorMoves++;
+    cursorRow++;
+    cursorColumn = 0;
+}
+
+void brain::lcd::clearScreen() {
+    sim::charge(sim::costs.screenClearScreen);
+    sim::screenStats().clearScreens++;
+    for(int i = 0; i < sim::SCREEN_ROWS; i++) { sim::screen[i][0] = '\0'; }
+}
+
+void brain::lcd::clearLine() { clearLine(cursorRow + 1); }
+
+void brain::lcd::clearLine(int32_t number) {
+    sim::charge(sim::costs.screenClearLine);
+    sim::screenStats().clearLines++;
+    if(number >= 1 && number <= sim::SCREEN_ROWS) { sim::screen[number - 1][0] = '\0'; }
+    cursorColumn = 0;
+}
+
+void brain::lcd::setOrigin(int32_t x, int32_t y) {
+    originX = x;
+    originY = y;
+    cursorRow = y / 20;
+    cursorColumn = x / 10;
+}
+
+/*------------------------------------ Battery ------------------------------------*/
+
+int32_t brain::battery::capacity(percentUnits units) { (void)units; return (int32_t)(sim::batteryCharge() * 100 + 0.5); }
+
+double brain::battery::voltage(voltageUnits units) {
+    sim::charge(sim::costs.deviceRead);
+    double volts = sim::batteryVoltage();
+    return units == voltageUnits::mV ? volts * 1000 : volts;
+}
+
+double brain::battery::current(currentUnits units) { (void)units; return 0; }
+
+/*------------------------------------ SD Card ------------------------------------*/
+
+static bool sdPathOf(const char *name, char *path, size_t size) {
+    if(sim::sdDirectory() == nullptr) { return false; }
+    snprintf(path, size, "%s/%s", sim::sdDirectory(), name);
+    return true;
+}
+
+static int32_t writeFile(const char *name, uint8_t *buffer, int32_t len, const char *mode) {
+    sim::charge(sim::costs.sdWrite);
+    char path[512];
+    if(!sdPathOf(name, path, sizeof(path))) { return 0; }
+    FILE *file = fopen(path, mode);
+    if(file == nullptr) { return 0; }
+    int32_t written = (int32_t)fwrite(buffer, 1, len, file);
+    fclose(file);
+    return written;
+}
+
+bool brain::sdcard::isInserted() { return sim::sdDirectory() != nullptr; }
+
+int32_t brain::sdcard::loadfile(const char *name, uint8_t *buffer, int32_t len) {
+    char path[512];
+    if(!sdPathOf(name, path, sizeof(path))) { return 0; }
+    FILE *file = fopen(path, "rb");
+    if(file == nullptr) { return 0; }
+    int32_t read = (int32_t)fread(buffer, 1, len, file);
+    fclose(file);
+    return read;
+}
+
+int32_t brain::sdcard::savefile(const char *name, uint8_t *buffer, int32_t len) { return writeFile(name, buffer, len, "wb"); }
+int32_t brain::sdcard::appendfile(const char *name, uint8_t *buffer, int32_t len) { return writeFile(name, buffer, len, "ab"); }
+
+int32_t brain::sdcard::size(const char *name) {
+    char path[512];
+    if(!sdPathOf(name, path, sizeof(path))) { return 0; }
+    FILE *file = fopen(path, "rb");
+    if(file == nullptr) { return 0; }
+    fseek(file, 0, SEEK_END);
+    int32_t length = (int32_t)ftell(file);
+    fclose(file);
+    return length;
+}
+
+bool brain::sdcard::exists(const char *name) {
+    char path[512];
+    if(!sdPathOf(name, path, sizeof(path))) { return false; }
+    FILE *file = fopen(path, "rb");
+    if(file == nullptr) { return false; }
+    fclose(file);
+    return true;
+}
+
+/*---------------------------------- Controller -----------------------------------*/
+
+int32_t controller::axis::value() {
+    sim::charge(sim::costs.deviceRead);
+    return sim::axes[index];
+}
+
+int32_t controller::axis::position(percentUnits units) {
+    (void)units;
+    return value() * 100 / 127;
+}
+
+bool controller::button::pressing() {
+    sim::charge(sim::costs.deviceRead);
+    return sim::buttons[index];
+}
+
+void controller::button::pressed(void (*callback)(void)) { sim::pressedCallbacks[index].push_back(callback); }
+void controller::button::released(void (*callback)(void)) { sim::releasedCallbacks[index].push_back(callback); }
+
+/*------------------------------------ Motors -------------------------------------*/
+
+motor::motor(int32_t index) : motor(index, gearSetting::ratio18_1, false) {}
+motor::motor(int32_t index, bool reverse) : motor(index, gearSetting::ratio18_1, reverse) {}
+/* Every motor by port, so the drive model can find the drive motors. */
+static motor *motorsByPort[V5_MAX_DEVICE_PORTS] = {};
+
+motor::motor(int32_t index, gearSetting gears, bool reverse) : port(index), gears(gears), reversed(reverse) {
+    if(index >= 0 && index < V5_MAX_DEVICE_PORTS) { motorsByPort[index] = this; }
+}
+
+double motor::maxRpm() {
+    switch(gears) {
+        case gearSetting::ratio36_1: return 100;
+        case gearSetting::ratio18_1: return 200;
+        case gearSetting::ratio6_1: return 600;
+    }
+    return 200;
+}
+
+double motor::toRpm(double value, velocityUnits units) {
+    switch(units) {
+        case velocityUnits::pct: return value * maxRpm() / 100.0;
+        case velocityUnits::rpm: return value;
+        case velocityUnits::dps: return value / 6.0;
+    }
+    return value;
+}
+
+/* Runs the motor model up to now, in steps of at most 1 ms (plenty for a 100 ms time constant). */
+void motor::updatePosition() {
+    uint64_t time = sim::now();
+    if(mode == Mode::stopped && currentVelocity == 0) {
+        appliedVoltage = 0;
+        updateTemperature((time - positionTime) / 1000000.0, 0); //Only cooling down
+        sim::drawCurrent(port, 0, 0);
+        positionTime = time;
+        return;
+    }
+    while(positionTime < time) {
+        uint64_t step = time - positionTime < 1000 ? time - positionTime : 1000;
+        simulateStep(step / 1000000.0);
+        positionTime += step;
+    }
+}
+
+void motor::simulateStep(double dt) {
+    const sim::MotorModel &model = sim::motorModel;
+    double previous = currentVelocity;
+
+    //A slipping wheel does not have the robot's inertia on it
+    double timeConstant = model.timeConstant * (sim::wheelSlipping(port) ? sim::driveModel.slippingInertia : 1);
+    if(mode == Mode::stopped && braking != brakeType::coast) {
+        //Braking shorts the motor, which stops it much faster than coasting
+        double fraction = dt / (timeConstant / 4);
+        currentVelocity -= currentVelocity * (fraction > 1 ? 1 : fraction);
+        if(fabs(currentVelocity) < 0.01) { currentVelocity = 0; }
+        appliedVoltage = 0;
+    } else {
+        double volts = 0;
+        if(mode == Mode::voltage) {
+            volts = target;
+        } else if(mode == Mode::velocity) {
+            volts = (target + model.velocityGain * (target - currentVelocity)) * 12.0 / maxRpm();
+        }
+        if(volts > 12) { volts = 12; }
+        if(volts < -12) { volts = -12; }
+        volts *= sim::batteryVoltage() / sim::batteryModel.commandVoltage;
+        //The current limit (lower once the motor is hot) caps how far the voltage can get from the back EMF
+        double backEmf = currentVelocity / maxRpm() * 12.0;
+        double headroom = 12.0 * maxTorque * sim::thermalThrottle(temperatureC);
+        if(volts > backEmf + headroom) { volts = backEmf + headroom; }
+        if(volts < backEmf - headroom) { volts = backEmf - headroom; }
+        appliedVoltage = volts;
+
+        //Friction and load always work against the way the motor is (or would start) turning
+        double drag = model.friction + sim::motorLoad(port);
+        double moving = currentVelocity != 0 ? currentVelocity : volts;
+        double effective = volts - (moving > 0 ? drag : (moving < 0 ? -drag : 0));
+        if(currentVelocity == 0 && fabs(volts) <= drag) { effective = 0; }
+
+        double heading = effective / 12.0 * maxRpm();
+        double fraction = dt / timeConstant;
+        currentVelocity += (heading - currentVelocity) * (fraction > 1 ? 1 : fraction);
+
+        //Friction can stop the motor, but never turn it around
+        if((previous > 0 && currentVelocity < 0 && volts > -drag) || (previous < 0 && currentVelocity > 0 && volts < drag)) {
+            currentVelocity = 0;
+        }
+    }
+
+    positionRevs += (previous + currentVelocity) / 2 * dt / 60.0;
+    double current = fabs(appliedVoltage - currentVelocity / maxRpm() * 12.0) / 12.0 * model.stallCurrent;
+    updateTemperature(dt, current);
+    sim::drawCurrent(port, mode == Mode::stopped ? 0 : current, dt); //Braking only shorts the motor, it takes nothing from the battery
+}
+
+void motor::updateTemperature(double dt, double current) {
+    const sim::MotorModel &model = sim::motorModel;
+    //Heats up with the power lost in the windings, and cools down in proportion to how much hotter than the air it is
+    double ambient = model.ambientTemperature;
+    temperatureC = ambient + (temperatureC - ambient) * exp(-dt / model.coolingTime) + model.heating * current * current * dt;
+}
+
+void motor::setStopping(brakeType mode) {
+    sim::recordMotorCommand(port, sim::MotorCommandType::setStopping, (double)(int)mode, 0);
+    stopping = mode;
+}
+
+void motor::setVelocity(double velocity, velocityUnits units) {
+    sim::recordMotorCommand(port, sim::MotorCommandType::setVelocity, velocity, (int32_t)units);
+    velocitySetting = toRpm(velocity, units);
+}
+
+void motor::setVelocity(double velocity, percentUnits units) {
+    setVelocity(velocity, (velocityUnits)units);
+}
+
+void motor::setMaxTorque(double value, percentUnits units) {
+    (void)units;
+    sim::recordMotorCommand(port, sim::MotorCommandType::setMaxTorque, value, 0);
+    updatePosition();
+    maxTorque = value < 0 ? 0 : value > 100 ? 1 : value / 100;
+}
+
+void motor::setMaxTorque(double value, currentUnits units) {
+    (void)units;
+    setMaxTorque(value / sim::motorModel.stallCurrent * 100, percentUnits::pct);
+}
+
+void motor::startSpinning(directionType dir) {
+    updatePosition();
+    double velocity = velocitySetting > maxRpm() ? maxRpm() : velocitySetting < -maxRpm() ? -maxRpm() : velocitySetting;
+    mode = Mode::velocity;
+    target = dir == directionType::rev ? -velocity : velocity;
+}
+
+void motor::spin(directionType dir) {
+    sim::recordMotorCommand(port, sim::MotorCommandType::spin, (double)(int)dir, 0);
+    startSpinning(dir);
+}
+
+void motor::spin(directionType dir, double velocity, velocityUnits units) {
+    //One command on the brain (it also becomes the velocity setting)
+    sim::recordMotorCommand(port, sim::MotorCommandType::spinVelocity, dir == directionType::rev ? -velocity : velocity, (int32_t)units);
+    velocitySetting = toRpm(velocity, units);
+    startSpinning(dir);
+}
+
+void motor::spin(directionType dir, double voltage, voltageUnits units) {
+    sim::recordMotorCommand(port, sim::MotorCommandType::spinVoltage, dir == directionType::rev ? -voltage : voltage, (int32_t)units);
+    updatePosition();
+    double volts = units == voltageUnits::mV ? voltage / 1000.0 : voltage;
+    mode = Mode::voltage;
+    target = dir == directionType::rev ? -volts : volts;
+}
+
+void motor::stop() { stop(stopping); }
+
+void motor::stop(brakeType mode) {
+    sim::recordMotorCommand(port, sim::MotorCommandType::stop, (double)(int)mode, 0);
+    updatePosition();
+    this->mode = Mode::stopped;
+    braking = mode;
+}
+
+bool motor::isSpinning() {
+    updatePosition();
+    return currentVelocity != 0;
+}
+
+double motor::velocity(velocityUnits units) {
+    sim::charge(sim::costs.deviceRead);
+    updatePosition();
+    switch(units) {
+        case velocityUnits::pct: return currentVelocity * 100.0 / maxRpm();
+        case velocityUnits::rpm: return currentVelocity;
+        case velocityUnits::dps: return currentVelocity * 6.0;
+    }
+    return currentVelocity;
+}
+
+double motor::position(rotationUnits units) {
+    sim::charge(sim::costs.deviceRead);
+    updatePosition();
+    switch(units) {
+        case rotationUnits::deg: return positionRevs * 360.0;
+        case rotationUnits::rev: return positionRevs;
+        case rotationUnits::raw: return positionRevs * 900.0;
+    }
+    return positionRevs;
+}
+
+void motor::resetPosition() {
+    updatePosition();
+    positionRevs = 0;
+}
+
+double motor::current(currentUnits units) {
+    (void)units;
+    sim::charge(sim::costs.deviceRead);
+    updatePosition();
+    //The voltage not cancelled out by the motor's own back EMF is what drives current through it
+    return fabs(appliedVoltage - currentVelocity / maxRpm() * 12.0) / 12.0 * sim::motorModel.stallCurrent;
+}
+
+double motor::temperature(temperatureUnits units) {
+    sim::charge(sim::costs.deviceRead);
+    updatePosition();
+    double step = sim::motorModel.temperatureStep;
+    double celsius = step > 0 ? floor(temperatureC / step) * step : temperatureC;
+    return units == temperatureUnits::fahrenheit ? celsius * 9 / 5 + 32 : celsius;
+}
+
+/*------------------------------------ Inertial -----------------------------------*/
+
+static double toDegrees(double value, rotationUnits units) {
+    return units == rotationUnits::rev ? value * 360.0 : value;
+}
+
+void inertial::calibrate() {
+    calibrationEnd = sim::now() + sim::driveModel.calibrationTime;
+}
+
+bool inertial::isCalibrating() {
+    sim::charge(sim::costs.deviceRead);
+    return sim::now() < calibrationEnd;
+}
+
+double inertial::rotation(rotationUnits units) {
+    sim::charge(sim::costs.deviceRead);
+    sim::updateDrive();
+    double drift = sim::driveModel.inertialDrift * sim::now() / 60000000.0;
+    double degrees = sim::truePose().heading + drift - offset;
+    return units == rotationUnits::rev ? degrees / 360.0 : degrees;
+}
+
+double inertial::heading(rotationUnits units) {
+    double degrees = fmod(rotation(rotationUnits::deg), 360.0);
+    if(degrees < 0) { degrees += 360.0; }
+    return units == rotationUnits::rev ? degrees / 360.0 : degrees;
+}
+
+double inertial::acceleration(axisType axis) {
+    sim::charge(sim::costs.deviceRead);
+    sim::updateDrive();
+    //Only speeding up straight ahead is modelled; the z axis just feels gravity
+    if(axis == axisType::yaxis) { return sim::forwardAcceleration() / 386.09; }
+    return axis == axisType::zaxis ? 1 : 0;
+}
+
+double inertial::gyroRate(axisType axis, velocityUnits units) {
+    sim::charge(sim::costs.deviceRead);
+    sim::updateDrive();
+    //Only turning on the field is modelled
+    double dps = axis == axisType::zaxis ? sim::turnRate() : 0;
+    return units == velocityUnits::rpm ? dps / 6.0 : dps;
+}
+
+void inertial::resetRotation() { setRotation(0, rotationUnits::deg); }
+
+void inertial::setRotation(double value, rotationUnits units) {
+    offset += rotation(rotationUnits::deg) - toDegrees(value, units);
+}
+
+/*------------------------------------ Optical ------------------------------------*/
+
+bool optical::isNearObject() {
+    sim::charge(sim::costs.deviceRead);
+    sim::updateBalls();
+    return sim::ballNear(port);
+}
+
+/*---------------------------------- Competition ----------------------------------*/
+
+void competition::autonomous(void (*callback)(void)) {
+    if(sim::autonomousPeriod()) { sim::spawn(callback, task::taskPriorityNormal, "autonomous"); }
+}
+
+void competition::drivercontrol(void (*callback)(void)) {
+    if(!sim::autonomousPeriod()) { sim::spawn(callback, task::taskPriorityNormal, "drivercontrol"); }
+}
+
+bool competition::isAutonomous() { return sim::autonomousPeriod(); }
+
+}
+
+/*------------------------------------ Drive --------------------------------------*/
+
+namespace sim {
+
+DriveModel driveModel;
+
+static int32_t driveLeft = -1, driveRight = -1;
+static double lastLeftTurns = 0, lastRightTurns = 0;
+static TruePose pose = {0, 0, 0};
+
+/* Where a wheel meets the floor: how fast that side of the robot is going (inches/s), and whether the wheel slips. */
+struct Contact {
+    double speed;
+    bool slipping;
+};
+
+static Contact leftContact = {0, false}, rightContact = {0, false};
+static uint64_t lastDriveTime = 0;
+static double acceleration = 0, turning = 0;
+
+/* How long the inertial sensor's own filtering takes to follow a change of acceleration or turn rate (s). */
+static const double ACCELERATION_FILTER = 0.005;
+
+double motorTurns(int32_t port) {
+    if(port < 0 || port >= V5_MAX_DEVICE_PORTS || !vex::motorsByPort[port]) { return 0; }
+    vex::motor *device = vex::motorsByPort[port];
+    device->updatePosition();
+    return device->positionRevs;
+}
+
+double motorVelocity(int32_t port) {
+    if(port < 0 || port >= V5_MAX_DEVICE_PORTS || !vex::motorsByPort[port]) { return 0; }
+    vex::motor *device = vex::motorsByPort[port];
+    device->updatePosition();
+    return device->currentVelocity;
+}
+
+void setMotorTemperature(int32_t port, double celsius) {
+    if(port < 0 || port >= V5_MAX_DEVICE_PORTS || !vex::motorsByPort[port]) { return; }
+    vex::motor *device = vex::motorsByPort[port];
+    device->updatePosition();
+    device->temperatureC = celsius;
+}
+
+double motorTemperature(int32_t port) {
+    if(port < 0 || port >= V5_MAX_DEVICE_PORTS || !vex::motorsByPort[port]) { return 0; }
+    vex::motor *device = vex::motorsByPort[port];
+    device->updatePosition();
+    return device->temperatureC;
+}
+
+void setDrive(int32_t leftPort, int32_t rightPort) {
+    driveLeft = leftPort;
+    driveRight = rightPort;
+    lastLeftTurns = motorTurns(leftPort);
+    lastRightTurns = motorTurns(rightPort);
+    pose = {0, 0, 0};
+    //Gripping, at whatever speed the wheels are already going
+    double inchesPerTurn = driveModel.wheelDiameter * M_PI;
+    leftContact = {motorVelocity(leftPort) / 60 * inchesPerTurn, false};
+    rightContact = {motorVelocity(rightPort) / 60 * inchesPerTurn, false};
+    lastDriveTime = now();
+    acceleration = 0;
+    turning = 0;
+}
+
+/*
+ * Moves one side of the robot along with its wheel for a step, as far as the
+ * floor lets it.
+ * @param double wheelDistance    How far the wheel turned (inches).
+ * @param double wheelSpeed       How fast it is turning now (inches/s).
+ * @returns double                How far that side went (inches).
+*/
+static double moveContact(Contact &contact, double wheelDistance, double wheelSpeed, double dt) {
+    double most = driveModel.traction * (contact.slipping ? driveModel.slidingTraction : 1) * dt;
+    double change = wheelSpeed - contact.speed;
+    if(fabs(change) <= most) {
+        contact.speed = wheelSpeed;
+        contact.slipping = false;
+        return wheelDistance;
+    }
+    double previous = contact.speed;
+    contact.speed += change > 0 ? most : -most;
+    contact.slipping = true;
+    return (previous + contact.speed) / 2 * dt;
+}
+
+void updateDrive() {
+    if(driveLeft < 0) { return; }
+    uint64_t time = now();
+    if(time == lastDriveTime) { return; }
+    double dt = (time - lastDriveTime) / 1000000.0;
+    lastDriveTime = time;
+    double left = motorTurns(driveLeft), right = motorTurns(driveRight);
+    double inchesPerTurn = driveModel.wheelDiameter * M_PI;
+    double before = (leftContact.speed + rightContact.speed) / 2;
+    double leftDistance = moveContact(leftContact, (left - lastLeftTurns) * inchesPerTurn,
+        motorVelocity(driveLeft) / 60 * inchesPerTurn, dt);
+    double rightDistance = moveContact(rightContact, (right - lastRightTurns) * inchesPerTurn,
+        motorVelocity(driveRight) / 60 * inchesPerTurn, dt);
+    lastLeftTurns = left;
+    lastRightTurns = right;
+    double raw = ((leftContact.speed + rightContact.speed) / 2 - before) / dt;
+    double fraction = dt / ACCELERATION_FILTER;
+    acceleration += (raw - acceleration) * (fraction > 1 ? 1 : fraction);
+    double rawTurning = (leftContact.speed - rightContact.speed) / (driveModel.trackWidth * driveModel.scrub) * 180.0 / M_PI;
+    turning += (rawTurning - turning) * (fraction > 1 ? 1 : fraction);
+
+    double turn = (leftDistance - rightDistance) / (driveModel.trackWidth * driveModel.scrub) * 180.0 / M_PI;
+    double middle = (pose.heading + turn / 2) * M_PI / 180.0;
+    double distance = (leftDistance + rightDistance) / 2;
+    pose.x += distance * sin(middle);
+    pose.y += distance * cos(middle);
+    pose.heading += turn;
+}
+
+TruePose truePose() { return pose; }
+
+bool wheelSlipping(int32_t port) {
+    if(port < 0) { return false; }
+    if(port == driveLeft) { return leftContact.slipping; }
+    return port == driveRight && rightContact.slipping;
+}
+
+double forwardAcceleration() { return acceleration; }
+
+double turnRate() { return turning; }
+
+/*------------------------------------- Balls -------------------------------------*/
+
+BallModel ballModel;
+
+static int32_t intakePort = -1, liftPort = -1, mouthPort = -1, topPort = -1;
+static double lastIntakeTurns = 0, lastLiftTurns = 0;
+/* Where each ball in the robot is (inches), the one nearest the top first. */
+static std::vector<double> balls;
+static int scored = 0, dropped = 0;
+
+void setIndexer(int32_t intake, int32_t lift, int32_t mouth, int32_t top) {
+    intakePort = intake;
+    liftPort = lift;
+    mouthPort = mouth;
+    topPort = top;
+    lastIntakeTurns = motorTurns(intake);
+    lastLiftTurns = motorTurns(lift);
+    balls.clear();
+    scored = 0;
+    dropped = 0;
+}
+
+void updateBalls() {
+    if(intakePort < 0) { return; }
+    double intakeTurns = motorTurns(intakePort), liftTurns = motorTurns(liftPort);
+    double intakeMoved = (intakeTurns - lastIntakeTurns) * ballModel.intakeDirection * ballModel.intakeInchesPerTurn;
+    double liftMoved = (liftTurns - lastLiftTurns) * ballModel.liftDirection * ballModel.liftInchesPerTurn;
+    lastIntakeTurns = intakeTurns;
+    lastLiftTurns = liftTurns;
+
+    //Each ball goes with the rollers it is on, but only as far as the ball it is carried into
+    double size = ballModel.diameter;
+    int count = (int)balls.size();
+    for(int i = 0; i < count; i++) {
+        double moved = balls[i] < ballModel.liftEntry ? intakeMoved : liftMoved;
+        if(moved <= 0) { continue; }
+        double to = balls[i] + moved;
+        if(i > 0 && to > balls[i - 1] - size) { to = balls[i - 1] - size; }
+        if(to > balls[i]) { balls[i] = to; }
+    }
+    for(int i = count - 1; i >= 0; i--) {
+        double moved = balls[i] < ballModel.liftEntry ? intakeMoved : liftMoved;
+        if(moved >= 0) { continue; }
+        double to = balls[i] + moved;
+        if(i < count - 1 && to < balls[i + 1] + size) { to = balls[i + 1] + size; }
+        if(to < balls[i]) { balls[i] = to; }
+    }
+
+    while(!balls.empty() && balls.front() > ballModel.exit) {
+        balls.erase(balls.begin());
+        scored++;
+    }
+    while(!balls.empty() && balls.back() < -size) {
+        balls.pop_back();
+        dropped++;
+    }
+}
+
+bool feedBall() {
+    updateBalls();
+    if(!balls.empty() && balls.back() < ballModel.diameter) { return false; }
+    balls.push_back(0);
+    return true;
+}
+
+void loadBall() {
+    updateBalls();
+    if(!balls.empty() && balls.front() > ballModel.topSensor - ballModel.diameter) { return; }
+    balls.insert(balls.begin(), ballModel.topSensor);
+}
+
+bool ballNear(int32_t port) {
+    if(port < 0 || (port != mouthPort && port != topPort)) { return false; }
+    double sensor = port == mouthPort ? 0 : ballModel.topSensor;
+    for(double ball : balls) {
+        if(fabs(ball - sensor) < ballModel.sensorReach) { return true; }
+    }
+    return false;
+}
+
+int ballsInRobot() { return (int)balls.size(); }
+
+double ballPosition(int index) { return index >= 0 && index < (int)balls.size() ? balls[index] : 0; }
+
+int ballsScored() { return scored; }
+int ballsDropped() { return dropped; }
+
+}
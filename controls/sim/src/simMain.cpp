@@ -0,0 +1,450 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       simMain.cpp                                                     */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Simulator Command Line Harness                                  */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+/**
+ * Usage: build-sim/controls-sim [options]
+ *
+ *   --seconds <s>      How much virtual time to run for (default 10, or the
+ *                      length of the replay).
+ *   --input <file>     Controller input script (see below).
+ *   --replay <log>     Replay the controller from a telemetry log (telemNNN.bin)
+ *                      made on the robot, one record per tick.
+ *   --log <file>       Write every motor command to a CSV file.
+ *   --compare <file>   Compare the motor commands with a CSV file written by
+ *                      --log (from an earlier build), and fail at the first
+ *                      tick where they differ.
+ *   --auton            Run vexcodeInit() and autonomous() instead of main().
+ *   --no-cost          Make SDK calls free (see sim::CostModel).
+ *   --screen           Print the brain's screen at the end of the run.
+ *   --sd <dir>         Use a host directory as the brain's SD card.
+ *   --bench <name>     Run one of the benchmarks in simBench.cpp and exit.
+ *
+ * Input scripts have one line per moment in time, with the time in
+ * milliseconds followed by the controls that change at that time:
+ *
+ *   # forward at full speed for a second while intaking
+ *   0     Axis3=127 R1=1
+ *   1000  Axis3=0   R1=0
+ *
+ * Axes are Axis1 to Axis4 (-127 to 127) and buttons are named like on the
+ * controller (L1, L2, R1, R2, Up, Down, Left, Right, X, B, Y, A).
+ *
+ * Replays are locked to the control loop's ticks instead of the times in the
+ * log: right after each tick starts (and has sampled the controller), the
+ * controller is set to the next record. Tick N of the replay always sees
+ * record N, so a replay sends exactly the same commands every time, however
+ * long the ticks take. Together with --log and --compare this is a regression
+ * test for changes to the drive code:
+ *
+ *   build-sim/controls-sim --replay telem004.bin --log before.csv
+ *   (change the code)
+ *   build-sim/controls-sim --replay telem004.bin --compare before.csv
+ *
+ * Motor commands are compared by tick (not by time), so changes that only
+ * make the code faster or slower are not differences.
+*/
+
+#include "vex.h"
+#include "autonomous.h"
+#include "latency.h"
+#include "odometry.h"
+#include "telemetry.h"
+#include "telemetryLog.h"
+#include "ticker.h"
+#include "sim.h"
+
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* main() from src/main.cpp, renamed by sim.mk */
+int vexMain();
+
+/* simBench.cpp */
+int runBenchmark(const char *name);
+
+struct InputChange {
+    uint64_t time;
+    int axis;
+    sim::Button button;
+    int32_t value;
+};
+
+static std::vector<InputChange> inputScript;
+
+static bool loadInputScript(const char *path) {
+    FILE *file = fopen(path, "r");
+    if(file == nullptr) {
+        fprintf(stderr, "controls-sim: cannot open %s\n", path);
+        return false;
+    }
+    char line[512];
+    int lineNumber = 0;
+    while(fgets(line, sizeof(line), file)) {
+        lineNumber++;
+        char *comment = strchr(line, '#');
+        if(comment) { *comment = '\0'; }
+
+        char *token = strtok(line, " \t\r\n");
+        if(token == nullptr) { continue; }
+        uint64_t time = strtoull(token, nullptr, 10) * 1000;
+
+        while((token = strtok(nullptr, " \t\r\n")) != nullptr) {
+            char *equals = strchr(token, '=');
+            if(equals == nullptr) {
+                fprintf(stderr, "%s:%d: expected control=value, got '%s'\n", path, lineNumber, token);
+                fclose(file);
+                return false;
+            }
+            *equals = '\0';
+            InputChange change = {time, 0, sim::NUM_BUTTONS, (int32_t)atoi(equals + 1)};
+            if(strncmp(token, "Axis", 4) == 0 && token[4] >= '1' && token[4] <= '4' && token[5] == '\0') {
+                change.axis = token[4] - '0';
+            } else {
+                change.button = sim::buttonFromName(token);
+                if(change.button == sim::NUM_BUTTONS) {
+                    fprintf(stderr, "%s:%d: unknown control '%s'\n", path, lineNumber, token);
+                    fclose(file);
+                    return false;
+                }
+            }
+            inputScript.push_back(change);
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+/* Applies the input script at the right virtual times. Runs above every robot
+ * task so that inputs are never late. */
+static void inputPlayer() {
+    for(const InputChange &change : inputScript) {
+        sim::sleepUntil(change.time);
+        if(change.axis != 0) {
+            sim::setAxis(change.axis, change.value);
+        } else {
+            sim::setButton(change.button, change.value != 0);
+        }
+    }
+}
+
+/* The controller state of one tick of a replay. */
+struct ReplayTick {
+    int32_t axes[NUM_AXES];
+    uint32_t buttons;
+};
+
+static std::vector<ReplayTick> replayTicks;
+
+static bool loadReplay(const char *path) {
+    TelemetryLog log;
+    if(!openTelemetryLog(path, log)) { return false; }
+
+    const char *axisNames[NUM_AXES] = {"axis1", "axis2", "axis3", "axis4"};
+    TelemetryLogChannel axes[NUM_AXES];
+    bool found = true;
+    for(int axis = 0; axis < NUM_AXES; axis++) {
+        axes[axis] = log.channel(axisNames[axis]);
+        found = found && axes[axis].found;
+    }
+    TelemetryLogChannel buttons = log.channel("buttons");
+    if(!found || !buttons.found) {
+        fprintf(stderr, "controls-sim: %s does not have the controller in it\n", path);
+        closeTelemetryLog(log);
+        return false;
+    }
+
+    for(size_t i = 0; i < log.recordCount(); i++) {
+        const uint8_t *record = log.record(i);
+        uint32_t pressed = (uint32_t)buttons.raw(record);
+        if(pressed & TELEMETRY_AUTONOMOUS) { continue; } //Nothing to replay
+        ReplayTick tick;
+        for(int axis = 0; axis < NUM_AXES; axis++) { tick.axes[axis] = (int32_t)axes[axis].raw(record); }
+        tick.buttons = pressed;
+        replayTicks.push_back(tick);
+    }
+    closeTelemetryLog(log);
+    return true;
+}
+
+static void applyReplayTick(const ReplayTick &tick) {
+    for(int axis = 0; axis < NUM_AXES; axis++) { sim::setAxis(axis + 1, tick.axes[axis]); }
+    for(int button = 0; button < sim::NUM_BUTTONS; button++) {
+        sim::setButton((sim::Button)button, (tick.buttons >> button) & 1);
+    }
+}
+
+/* When every control tick started, from controlTicker. */
+static std::vector<uint64_t> tickStarts;
+
+/* Watches controlTicker for new ticks, and moves the replay (if any) to the
+ * next record after each one. Runs above every robot task. Polling costs no
+ * virtual time, so it does not change when anything on the robot happens. */
+static void tickWatcher() {
+    size_t next = 0;
+    if(!replayTicks.empty()) { applyReplayTick(replayTicks[next++]); }
+
+    uint64_t seen = 0;
+    while(1) {
+        uint64_t start = controlTicker.getTickStart();
+        if(start != seen) {
+            seen = start;
+            tickStarts.push_back(start);
+            if(next < replayTicks.size()) {
+                applyReplayTick(replayTicks[next++]);
+            } else if(next == replayTicks.size() && next > 0) {
+                ReplayTick letGo = {};
+                applyReplayTick(letGo);
+                next++;
+            }
+        }
+        sim::sleepFor(1000);
+    }
+}
+
+/* Moves the simulated robot along every millisecond (see sim::DriveModel). Costs no virtual time. */
+static void driveUpdater() {
+    while(1) {
+        sim::updateDrive();
+        sim::sleepFor(1000);
+    }
+}
+
+/* @returns long    The tick a time was in (-1 before the first one). */
+static long tickAt(uint64_t time) {
+    return (long)(std::upper_bound(tickStarts.begin(), tickStarts.end(), time) - tickStarts.begin()) - 1;
+}
+
+static void robotMain() { vexMain(); }
+
+static void robotAutonomous() {
+    vexcodeInit();
+    autonomous();
+}
+
+static const char * const MOTOR_LOG_HEADER = "time_us,tick,port,command,value,unit";
+
+/* Everything about a command but its time, like in a row of the motor log. */
+static void formatMotorCommand(const sim::MotorCommand &command, char *text, size_t size) {
+    snprintf(text, size, "%ld,%ld,%s,%g,%ld", tickAt(command.time), (long)command.port + 1,
+        sim::motorCommandName(command.type), command.value, (long)command.unit);
+}
+
+static bool writeMotorLog(const char *path) {
+    FILE *file = fopen(path, "w");
+    if(file == nullptr) {
+        fprintf(stderr, "controls-sim: cannot write %s\n", path);
+        return false;
+    }
+    fprintf(file, "%s\n", MOTOR_LOG_HEADER);
+    char row[128];
+    for(const sim::MotorCommand &command : sim::motorCommands()) {
+        formatMotorCommand(command, row, sizeof(row));
+        fprintf(file, "%llu,%s\n", (unsigned long long)command.time, row);
+    }
+    fclose(file);
+    return true;
+}
+
+/* Compares the motor commands with a log from writeMotorLog(), ignoring the
+ * times. Prints the first difference and returns false if there is one. */
+static bool compareMotorLog(const char *path) {
+    FILE *file = fopen(path, "r");
+    if(file == nullptr) {
+        fprintf(stderr, "controls-sim: cannot open %s\n", path);
+        return false;
+    }
+    char line[256];
+    if(!fgets(line, sizeof(line), file) || strncmp(line, MOTOR_LOG_HEADER, strlen(MOTOR_LOG_HEADER)) != 0) {
+        fprintf(stderr, "controls-sim: %s is not a motor log from --log\n", path);
+        fclose(file);
+        return false;
+    }
+
+    const std::vector<sim::MotorCommand> &commands = sim::motorCommands();
+    char row[128];
+    size_t index = 0;
+    bool same = true;
+    while(same) {
+        bool expected = fgets(line, sizeof(line), file) != nullptr;
+        bool actual = index < commands.size();
+        if(!expected && !actual) { break; }
+
+        //Everything after the time
+        char *want = expected ? strchr(line, ',') : nullptr;
+        want = want ? want + 1 : (char *)"(nothing)";
+        want[strcspn(want, "\r\n")] = '\0';
+        if(actual) {
+            formatMotorCommand(commands[index], row, sizeof(row));
+        } else {
+            strcpy(row, "(nothing)");
+        }
+
+        if(strcmp(want, row) != 0) {
+            long tick = actual ? tickAt(commands[index].time) : atol(want);
+            printf("motor commands differ from %s at command %zu (tick %ld)\n", path, index, tick);
+            printf("    expected  %s\n", want);
+            printf("    got       %s\n", row);
+            if(tick >= 0 && (size_t)tick < replayTicks.size()) {
+                const ReplayTick &input = replayTicks[tick];
+                printf("    input     Axis1=%ld Axis2=%ld Axis3=%ld Axis4=%ld buttons=0x%03lx\n",
+                    (long)input.axes[0], (long)input.axes[1], (long)input.axes[2], (long)input.axes[3],
+                    (unsigned long)input.buttons);
+            }
+            same = false;
+        }
+        index++;
+    }
+    fclose(file);
+    if(same) { printf("motor commands match %s (%zu commands)\n", path, commands.size()); }
+    return same;
+}
+
+/* The time from each scripted change of a drive axis to the next command sent
+ * to a drive motor. Unlike inputLatencyHistogram (which starts when the robot
+ * samples the controller) this includes the time until the sample. */
+static void printScriptLatency() {
+    Histogram latency;
+    const std::vector<sim::MotorCommand> &commands = sim::motorCommands();
+    int32_t drivePorts[NUM_WHEEL_TRAINS];
+    for(int i=0; i<NUM_WHEEL_TRAINS; i++) { drivePorts[i] = wheelTrains[i]->wheelMotor.device->index(); }
+
+    for(const InputChange &change : inputScript) {
+        if(change.axis - 1 != forwardAxis && change.axis - 1 != turningAxis) { continue; }
+        for(const sim::MotorCommand &command : commands) {
+            bool drive = false;
+            for(int i=0; i<NUM_WHEEL_TRAINS; i++) { drive = drive || command.port == drivePorts[i]; }
+            if(drive && command.time >= change.time) {
+                latency.record((uint32_t)(command.time - change.time));
+                break;
+            }
+        }
+    }
+    if(latency.count() > 0) {
+        printf("stick to drive command (from the input script, us)\n");
+        printf("    n %lu  p50 %lu  p95 %lu  max %lu\n", (unsigned long)latency.count(),
+            (unsigned long)latency.percentile(50), (unsigned long)latency.percentile(95), (unsigned long)latency.max());
+    }
+}
+
+static void printSummary(double realSeconds) {
+    double virtualSeconds = sim::now() / 1000000.0;
+    printf("virtual time      %.3f s (%.3f s real, %.0fx real time)\n", virtualSeconds, realSeconds,
+        realSeconds > 0 ? virtualSeconds / realSeconds : 0.0);
+    if(!tickStarts.empty()) {
+        printf("control ticks     %zu (%.1f us real each)", tickStarts.size(), realSeconds * 1000000.0 / tickStarts.size());
+        if(!replayTicks.empty()) { printf(", replayed %zu", std::min(replayTicks.size(), tickStarts.size())); }
+        printf("\n");
+    }
+    printf("motor commands    %zu\n", sim::motorCommands().size());
+
+    long perPort[V5_MAX_DEVICE_PORTS] = {};
+    for(const sim::MotorCommand &command : sim::motorCommands()) { perPort[command.port]++; }
+    for(int port = 0; port < V5_MAX_DEVICE_PORTS; port++) {
+        if(perPort[port]) { printf("    port %-2d       %ld\n", port + 1, perPort[port]); }
+    }
+
+    const sim::ScreenStats &screen = sim::screenStats();
+    printf("screen calls      %llu (%llu prints, %llu clear screens, %llu clear lines, %llu cursor moves)\n",
+        (unsigned long long)screen.total(), (unsigned long long)screen.prints,
+        (unsigned long long)screen.clearScreens, (unsigned long long)screen.clearLines,
+        (unsigned long long)screen.cursorMoves);
+
+    char report[512];
+    formatLatencyReport(report, sizeof(report));
+    printf("latency histograms\n%s", report);
+    printScriptLatency();
+
+    Pose odometry = getRobotPose();
+    sim::TruePose truth = sim::truePose();
+    printf("pose              odometry x %.1f y %.1f %.1f deg, really x %.1f y %.1f %.1f deg (off by %.2f in, %.2f deg)\n",
+        odometry.x, odometry.y, odometry.heading, truth.x, truth.y, truth.heading,
+        sqrt((odometry.x - truth.x) * (odometry.x - truth.x) + (odometry.y - truth.y) * (odometry.y - truth.y)),
+        fabs(odometry.heading - truth.heading));
+    printf("odometry update   %lu us last, %lu us worst (virtual)\n",
+        (unsigned long)odometryUpdateTime, (unsigned long)odometryWorstUpdateTime);
+
+if(telemetryFile[0] != '\0') {
+        TelemetryStats telemetry = getTelemetryStats();
+        printf("telemetry         %lu recorded, %lu written to %s, %lu dropped (full), %lu dropped (SD)\n",
+            (unsigned long)telemetry.recorded, (unsigned long)telemetry.written, telemetryFile,
+            (unsigned long)telemetry.droppedFull, (unsigned long)telemetry.droppedWrite);
+    }
+}
+
+int main(int argc, char **argv) {
+    double seconds = 0;
+    const char *logPath = nullptr;
+    const char *comparePath = nullptr;
+    bool auton = false;
+    bool showScreen = false;
+
+    for(int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        bool hasValue = i + 1 < argc;
+        if(strcmp(arg, "--seconds") == 0 && hasValue) {
+            seconds = atof(argv[++i]);
+        } else if(strcmp(arg, "--input") == 0 && hasValue) {
+            if(!loadInputScript(argv[++i])) { return 1; }
+        } else if(strcmp(arg, "--replay") == 0 && hasValue) {
+            if(!loadReplay(argv[++i])) { return 1; }
+        } else if(strcmp(arg, "--log") == 0 && hasValue) {
+            logPath = argv[++i];
+        } else if(strcmp(arg, "--compare") == 0 && hasValue) {
+            comparePath = argv[++i];
+        } else if(strcmp(arg, "--auton") == 0) {
+            auton = true;
+        } else if(strcmp(arg, "--no-cost") == 0) {
+            sim::costs.screenPrint = sim::costs.screenClearScreen = sim::costs.screenClearLine = 0;
+            sim::costs.deviceRead = sim::costs.motorCommand = 0;
+        } else if(strcmp(arg, "--screen") == 0) {
+            showScreen = true;
+        } else if(strcmp(arg, "--sd") == 0 && hasValue) {
+            sim::setSdDirectory(argv[++i]);
+        } else if(strcmp(arg, "--bench") == 0 && hasValue) {
+            return runBenchmark(argv[++i]);
+        } else {
+            fprintf(stderr, "controls-sim: unknown option '%s' (see sim/src/simMain.cpp)\n", arg);
+            return 1;
+        }
+    }
+
+    if(seconds <= 0) {
+        //Long enough for the whole replay, plus starting up and letting go of the controls
+        seconds = replayTicks.empty() ? 10 : replayTicks.size() * TICK_LENGTH / 1000.0 + 1;
+    }
+
+    sim::setAutonomousPeriod(auton);
+    sim::spawn(inputPlayer, vex::task::taskPriorityHigh + 1, "input");
+    sim::spawn(tickWatcher, vex::task::taskPriorityHigh + 1, "ticks");
+    sim::setDrive(leftWheelTrainMotor.index(), rightWheelTrainMotor.index());
+    sim::spawn(driveUpdater, vex::task::taskPriorityHigh + 1, "drive");
+    if(auton) {
+        sim::spawn(robotAutonomous, vex::task::taskPriorityNormal, "autonomous");
+    } else {
+        sim::spawn(robotMain, vex::task::taskPriorityNormal, "main");
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    sim::run((uint64_t)(seconds * 1000000.0));
+    double realSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    flushTelemetry(); //Like the end of a match
+
+    printSummary(realSeconds);
+    if(showScreen) {
+        printf("screen:\n");
+        for(int row = 0; row < sim::SCREEN_ROWS; row++) { printf("    |%s\n", sim::screenRow(row)); }
+    }
+    if(logPath && !writeMotorLog(logPath)) { return 1; }
+    if(comparePath && !compareMotorLog(comparePath)) { return 1; }
+    return 0;
+}
@@ -0,0 +1,159 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       actions.cpp                                                     */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Autonomous Action Scheduler Implementation                      */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include <cmath>
+
+using namespace vex;
+
+#include "actions.h"
+#include "functionality.h"
+#include "ticker.h"
+#include "telemetry.h"
+
+void IntakeAction::begin() {
+    start = timer::system();
+    intakeMotors(direction);
+}
+
+bool IntakeAction::step(const Pose &) {
+    return ms > 0 && timer::system() - start >= (uint32_t)ms;
+}
+
+void IntakeAction::end() {
+    intakeMotors(stopIntake);
+}
+
+void LiftAction::begin() {
+    start = timer::system();
+    liftMotors(direction);
+}
+
+bool LiftAction::step(const Pose &) {
+    return ms > 0 && timer::system() - start >= (uint32_t)ms;
+}
+
+void LiftAction::end() {
+    liftMotors(stopLift);
+}
+
+int ActionPlan::add(Action &action, StartCondition when) {
+    if(count >= MAX_PLAN_ACTIONS) { return -1; }
+    actions[count] = &action;
+    conditions[count] = when;
+    states[count] = waiting;
+    startTimes[count] = 0;
+    endTimes[count] = 0;
+    return count++;
+}
+
+/* Whether a waiting action can start now. */
+bool ActionPlan::ready(int action, uint32_t now) {
+    if(actions[action]->parts & busyParts) { return false; }
+    const StartCondition &condition = conditions[action];
+    switch(condition.kind) {
+        case StartCondition::afterTime:
+            return now - startTime >= (uint32_t)condition.value;
+        case StartCondition::afterDistance:
+            return travelled >= condition.value;
+        case StartCondition::afterAction:
+            return states[(int)condition.value] == finished;
+        default:
+            return true;
+    }
+}
+
+/* Steps a running action, and finishes it if it is done. */
+void ActionPlan::stepAction(int action, const Pose &pose) {
+    if(actions[action]->step(pose)) {
+        actions[action]->end();
+        states[action] = finished;
+        endTimes[action] = timer::system() - startTime;
+        busyParts &= ~actions[action]->parts;
+    }
+}
+
+bool ActionPlan::step() {
+    uint32_t now = timer::system();
+    Pose pose = getRobotPose();
+    if(!started) {
+        started = true;
+        startTime = now;
+        lastX = pose.x;
+        lastY = pose.y;
+    }
+    travelled += hypot(pose.x - lastX, pose.y - lastY);
+    lastX = pose.x;
+    lastY = pose.y;
+
+    //Step the running actions, then start any that can now (they step straight away, so an action can start on the
+    //same tick the one before it finished)
+    for(int i = 0; i < count; i++) {
+        if(states[i] == running) { stepAction(i, pose); }
+    }
+    bool startedOne = true;
+    while(startedOne) {
+        startedOne = false;
+        for(int i = 0; i < count; i++) {
+            if(states[i] == waiting && ready(i, now)) {
+                states[i] = running;
+                startTimes[i] = now - startTime;
+                busyParts |= actions[i]->parts;
+                actions[i]->begin();
+                stepAction(i, pose);
+                startedOne = true;
+            }
+        }
+    }
+
+    bool allFinished = true;
+    for(int i = 0; i < count; i++) {
+        allFinished = allFinished && states[i] == finished;
+    }
+
+    updateWheels(); //Accelerate gradually towards the goal velocities the drive actions set
+
+    //There is no controller input during autonomous, only the wheels are recorded
+    InputFrame noInput;
+    memset(&noInput, 0, sizeof(noInput));
+    noInput.time = timer::systemHighResolution();
+    recordTelemetry(noInput, true);
+    return allFinished;
+}
+
+bool ActionPlan::run(int timeout) {
+    uint32_t start = timer::system();
+    controlTicker.start();
+    bool allFinished = step();
+    while(!allFinished && timer::system() - start < (uint32_t)timeout) {
+        //Each tick is exactly TICK_LENGTH long, no matter how long the work in it took
+        controlTicker.waitForNextTick();
+        allFinished = step();
+    }
+    controlTicker.stop(); //So the watchdog does not expect ticks until the next move
+    if(!allFinished) { stop(); }
+    return allFinished;
+}
+
+void ActionPlan::stop() {
+    for(int i = 0; i < count; i++) {
+        if(states[i] == running) {
+            actions[i]->end();
+            states[i] = finished;
+            endTimes[i] = timer::system() - startTime;
+        }
+    }
+    busyParts = 0;
+}
+
+void runAction(Action &action) {
+    ActionPlan plan;
+    plan.add(action);
+    plan.run(INT32_MAX);
+}
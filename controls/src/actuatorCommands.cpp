@@ -0,0 +1,121 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       actuatorCommands.cpp                                            */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Intake And Lift Command Queue Implementation                    */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "actuatorCommands.h"
+#include "functionality.h"
+#include "indexer.h"
+#include "latency.h"
+
+CommandQueue actuatorQueue;
+
+CommandQueue::CommandQueue() : head(0), tail(0), dropped(0) {
+    for(uint32_t i=0; i<CAPACITY; i++) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool CommandQueue::push(const ActuatorCommand &command) {
+    uint32_t position = head.load(std::memory_order_relaxed);
+    Slot *slot;
+    while(1) {
+        slot = &slots[position & (CAPACITY - 1)];
+        int32_t turn = (int32_t)(slot->sequence.load(std::memory_order_acquire) - position);
+        if(turn == 0) {
+            //Our turn for this slot, as long as no other producer claims it first
+            if(head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) { break; }
+        } else if(turn < 0) {
+            //The consumer has not taken this slot from the last lap yet, so the queue is full
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            //Another producer got here first, try the next slot
+            position = head.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->command = command;
+    slot->sequence.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+bool CommandQueue::pop(ActuatorCommand &command) {
+    uint32_t position = tail.load(std::memory_order_relaxed);
+    Slot &slot = slots[position & (CAPACITY - 1)];
+    if(slot.sequence.load(std::memory_order_acquire) != position + 1) { return false; } //Empty, or still being written
+
+    command = slot.command;
+    slot.sequence.store(position + CAPACITY, std::memory_order_release);
+    tail.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+void postActuatorCommand(int intent, bool pressing) {
+    ActuatorCommand command;
+    command.intent = (uint8_t)intent;
+    command.pressing = pressing;
+    command.time = (uint32_t)timer::systemHighResolution();
+    actuatorQueue.push(command);
+}
+
+void registerActuatorButtons() {
+    //Using lambdas here btw (learn more: https://en.cppreference.com/w/cpp/language/lambda)
+    //These run on the SDK's event threads, so they only post what happened and the control loop does the rest
+    functionUp.pressed([](){postActuatorCommand(liftUpIntent, true);});
+    functionDown.pressed([](){postActuatorCommand(liftDownIntent, true);});
+    functionUp.released([](){postActuatorCommand(liftUpIntent, false);});
+    functionDown.released([](){postActuatorCommand(liftDownIntent, false);});
+
+    functionIntake.pressed([](){postActuatorCommand(intakeIntent, true);});
+    functionExpel.pressed([](){postActuatorCommand(expelIntent, true);});
+    functionIntake.released([](){postActuatorCommand(intakeIntent, false);});
+    functionExpel.released([](){postActuatorCommand(expelIntent, false);});
+}
+
+/* Only touched by the control loop. */
+static uint32_t held = 0;
+
+uint32_t getHeldIntents() { return held; }
+
+static bool holding(int intent) { return (held >> intent) & 1; }
+
+void applyActuatorCommands() {
+    uint32_t waiting = actuatorQueue.size();
+    if(waiting > 0) { commandDepthHistogram.record(waiting); }
+
+    ActuatorCommand command;
+    uint32_t posted[CommandQueue::CAPACITY];
+    int applied = 0;
+    while(actuatorQueue.pop(command)) {
+        if(command.intent >= NUM_ACTUATOR_INTENTS) { continue; }
+        if(command.pressing) {
+            held |= 1u << command.intent;
+        } else {
+            held &= ~(1u << command.intent);
+        }
+        if(applied < (int)CommandQueue::CAPACITY) { posted[applied++] = command.time; }
+    }
+
+    //The motors are set from what is held every tick, not just when something changed, which costs nothing
+    //thanks to the motor cache (see motorCache.h)
+    int lift = holding(liftDownIntent) ? down : holding(liftUpIntent) ? up : stopLift;
+    int intaking = holding(expelIntent) ? expel : holding(intakeIntent) ? intake : stopIntake;
+    indexBalls(lift, intaking);
+    liftMotors(lift);
+    intakeMotors(intaking);
+
+    //Each command waited from when it was posted until the motors were set
+    uint32_t now = (uint32_t)timer::systemHighResolution();
+    for(int i=0; i<applied; i++) {
+        commandLatencyHistogram.record(now - posted[i]);
+    }
+}
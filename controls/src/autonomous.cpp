@@ -19,6 +19,10 @@ using namespace vex;
 #include "functionality.h"
 #include "autonomous.h"
 #include "debugScreen.h"
+#include "ticker.h"
+#include "telemetry.h"
+#include "odometry.h"
+#include "driveMoves.h"
 
 /* Using these values, all that is needed is to multiply some values by the side, thus making some negative and some positive
  * Sides:
@@ -41,7 +45,7 @@ void pause(int milliseconds) { wait(milliseconds, timeUnits::msec); }
 void stopWheels() {
     for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
         wheelTrains[i]->setVelocity(0);
-        wheelTrains[i]->wheelMotor->stop(brake);
+        wheelTrains[i]->stop(brake);
     }
 }
 
@@ -55,18 +59,27 @@ void stopWheels() {
 */
 void timedMovement(int forward, int turnValue, int ms) {
 
-    movement(forward, turnValue);
+    setWheelGoals(forward, turnValue);
 
-    while(ms > 0) { //Break if time is up
+    //There is no controller input during autonomous, only the wheels are recorded
+    InputFrame noInput;
+    memset(&noInput, 0, sizeof(noInput));
 
-        /*for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
-            wheelTrains[i]->calculateAcceleratingVelocity();
-        }*/
-        
-        pause(TICK_LENGTH);
-        ms = ms - TICK_LENGTH;
+    //Counting ticks would run long whenever a tick overran (the ticker skips the ticks it missed), so the clock is checked instead
+    uint32_t end = timer::system() + ms;
+    controlTicker.start();
+    while((int32_t)(end - timer::system()) > 0) { //Break if time is up
+        updateWheels(); //Accelerate gradually towards the goal velocities
+
+        noInput.time = timer::systemHighResolution();
+        recordTelemetry(noInput, true);
+
+        //Each tick is exactly TICK_LENGTH long, no matter how long the work in it took
+        controlTicker.waitForNextTick();
     }
 
+    controlTicker.stop(); //So the watchdog does not expect ticks until the next move
+
     //We want the robot to stop moving now
     movement(0,0);
     stopWheels();
@@ -93,6 +106,31 @@ void timedMovement(int forward, int turnValue, int ms) {
  * reversing a number's sign).
  *
  * Functions you will likely need to use: (see the respective indepth documentation above the function's declaration in the header file)
+ *      driveDistance(double inches), turnToHeading(double heading) and driveArc(double radius, double degrees)
+ *          Located in the driveMoves.h file.
+ *          These move by a distance or to a heading instead of for a time, using the robot's position (see odometry.h), so they end up
+ *                  in the same place however charged the battery is. Prefer these to timedMovement.
+ *          Turns are already mirrored on the left side (see MIRROR), so write the route for the right side and do NOT multiply by SIDE.
+ *              For example, the following lines drive 24 inches, face 90 degrees right (left on the left side) and drive back 12 inches:
+ *                  1. driveDistance(24);
+ *                  2. turnToHeading(90);
+ *                  3. driveDistance(-12);
+ *          Each one returns false if it timed out (like when the robot is stuck against something), so you can give up on a step.
+ *
+ *      followPath(const Path &path)
+ *          Located in the pathFollower.h file.
+ *          This drives along a smooth curve through a list of waypoints without stopping, which is much quicker than stopping to turn
+ *                  at each one. Make the Path once (they are big), before it is needed:
+ *                  1. static const Waypoint route[] = {{0, 0}, {0, 20}, {20, 40}, {50, 40}};
+ *                  2. static Path path(route, 4);
+ *                  3. followPath(path);
+ *
+ *      followTrajectory(const TrajectoryTable &trajectory)
+ *          Located in the trajectories.h file.
+ *          Like followPath, but the route is worked out on the computer ahead of time, so it takes no time or memory on the robot.
+ *                  Add the route to routes.h, run `make -f sim.mk` to make its table, then (for HOME_ROW):
+ *                  1. followTrajectory(homeRowTrajectory);
+ *
  *      timedMovement(double forward, double turnValue, int ms)
  *          Located in the autonomous.h file.
  *          This will cause the robot to move in the desired direction ('forward') for an amount of time ('ms').
@@ -101,13 +139,24 @@ void timedMovement(int forward, int turnValue, int ms) {
  *              For example, the following lines will run for 1500 milliseconds (1000 + 500 = 1500):
  *                  1. timedMovement(100, 0, 1000);
  *                  2. pause(500);
- *              If you want the robot to start moving the lift and intake motors while the robot is moving, then you must split the movement
- *                      into multiple function calls.
- *                    For example, the following lines causes the robot to start moving, then half a second in, start moving the ball function motors
- *                          (then stop moving half a second later):
- *                      1. timedMovement(100, 0, 500); //this timedMovement call was split in two so that the ball function motors could move after half a second
- *                      2. ballFunction(up); 
- *                      3. timedMovement(100, 0, 500);
+ *              If you want the robot to start moving the lift and intake motors while the robot is moving, use an ActionPlan (below) instead
+ *                      of splitting the movement into multiple function calls.
+ *
+ *      ActionPlan
+ *          Located in the actions.h file.
+ *          This runs drive moves (DriveDistance, TurnToHeading, DriveArc, FollowPath, FollowTrajectory) and ball handling (IntakeAction,
+ *                  LiftAction) at the same time, each starting at a time, after the robot has driven a distance, or after another action.
+ *              For example, the following lines drive to a ball, starting the intake 16 inches in, then turn and lift the ball once turned:
+ *                  1. DriveDistance toBall(24);
+ *                  2. IntakeAction intakeBall(intake, 1000);
+ *                  3. TurnToHeading toGoal(90);
+ *                  4. LiftAction liftBall(up, 800);
+ *                  5. ActionPlan plan;
+ *                  6. int driving = plan.add(toBall);
+ *                  7. plan.add(intakeBall, startAfterDriving(16));
+ *                  8. int turning = plan.add(toGoal, startAfter(driving));
+ *                  9. plan.add(liftBall, startAfter(turning));
+ *                  10. plan.run();
  *
  *      ballFunction(int direction)
  *          Located in the functionality.h file.
@@ -120,5 +169,8 @@ void timedMovement(int forward, int turnValue, int ms) {
  *
 */
 void autonomous() {
-    //angular_accelerational_constant = 0.2;
+    for(int i=0; i<NUM_WHEEL_TRAINS; i++) { //Gentler acceleration, so the robot ends up where it is meant to
+        wheelTrains[i]->setLimits(AUTONOMOUS_LIMITS);
+    }
+    resetOdometry(0, 0, 0); //Positions are measured from where the robot starts (see odometry.h)
 }
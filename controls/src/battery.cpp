@@ -0,0 +1,37 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       battery.cpp                                                     */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Battery Voltage Compensation Implementation                     */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "battery.h"
+
+bool batteryCompensation = true;
+
+/* Only written by the wheel control task. */
+static double voltage = NOMINAL_BATTERY_VOLTAGE;
+static double lowest = 0;
+static bool known = false;
+
+void updateBattery() {
+    double reading = vexBrain.Battery.voltage(volt);
+    if(reading < MIN_BATTERY_READING) { return; }
+    voltage = known ? voltage + (reading - voltage) * BATTERY_SMOOTHING : reading;
+    if(!known || voltage < lowest) { lowest = voltage; }
+    known = true;
+}
+
+double batteryVoltage() { return voltage; }
+
+double lowestBatteryVoltage() { return known ? lowest : voltage; }
+
+double batteryScale() {
+    return batteryCompensation ? NOMINAL_BATTERY_VOLTAGE / voltage : 1;
+}
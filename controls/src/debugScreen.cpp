@@ -7,6 +7,8 @@
 /*                                                                                  */
 /*----------------------------------------------------------------------------------*/
 #include "vex.h"
+#include <atomic>
+#include <stdarg.h>
 
 using namespace vex;
 
@@ -14,125 +16,325 @@ using namespace vex;
 #include "functionality.h"
 #include "debugScreen.h"
 #include "autonomous.h"
+#include "ticker.h"
+#include "latency.h"
+#include "odometry.h"
+#include "actuatorCommands.h"
+#include "emergencyStop.h"
+#include "watchdog.h"
+#include "thermal.h"
+#include "battery.h"
+#include "indexer.h"
 
 /** The temperature units used to report the temperature on the debug screen. */
 temperatureUnits u = temperatureUnits::celsius;
 
-void leftAnalogStick() {
-    vexBrain.Screen.print("Axis 1 | ");
-    vexBrain.Screen.print(mainCon.Axis1.value());
-    vexBrain.Screen.print(" | Axis 2 | ");
-    vexBrain.Screen.print(mainCon.Axis2.value());
-}
-
-void rightAnalogStick() {
-    vexBrain.Screen.print("Axis 4 | ");
-    vexBrain.Screen.print(mainCon.Axis3.value());
-    vexBrain.Screen.print(" | Axis 3 | ");
-    vexBrain.Screen.print(mainCon.Axis4.value());
-}
-
-void buttons() {
-    vexBrain.Screen.print("A | ");
-    vexBrain.Screen.print(mainCon.ButtonA.pressing());
-    vexBrain.Screen.print(" | B | ");
-    vexBrain.Screen.print(mainCon.ButtonB.pressing());
-    vexBrain.Screen.print(" | X | ");
-    vexBrain.Screen.print(mainCon.ButtonX.pressing());
-    vexBrain.Screen.print(" | Y | ");
-    vexBrain.Screen.print(mainCon.ButtonY.pressing());
-}
-
-void arrows() {
-    vexBrain.Screen.print("v | ");
-    vexBrain.Screen.print(mainCon.ButtonDown.pressing());
-    vexBrain.Screen.print(" | ^ | ");
-    vexBrain.Screen.print(mainCon.ButtonUp.pressing());
-    vexBrain.Screen.print(" | > | ");
-    vexBrain.Screen.print(mainCon.ButtonRight.pressing());
-    vexBrain.Screen.print(" | < | ");
-    vexBrain.Screen.print(mainCon.ButtonLeft.pressing());
-}
-
-
-void bumpers() {
-    vexBrain.Screen.print("L1 | ");
-    vexBrain.Screen.print(mainCon.ButtonL1.pressing());
-    vexBrain.Screen.print(" | L2 | ");
-    vexBrain.Screen.print(mainCon.ButtonL2.pressing());
-    vexBrain.Screen.print(" | R1 | ");
-    vexBrain.Screen.print(mainCon.ButtonR1.pressing());
-    vexBrain.Screen.print(" | R2 | ");
-    vexBrain.Screen.print(mainCon.ButtonR2.pressing());
-}
-
-void temperature() {
-    if(u == temperatureUnits::celsius) { vexBrain.Screen.print("Motor Temperature: (celcius)"); }
-    if(u == temperatureUnits::fahrenheit) { vexBrain.Screen.print("Motor Temperature: (fahrenheit)"); }
-    vexBrain.Screen.newLine();
-
-    //Wheels
-    vexBrain.Screen.print("rw : ");
-    vexBrain.Screen.print(rightWheelTrainMotor.temperature(u));
-    vexBrain.Screen.print(" | lw : ");
-    vexBrain.Screen.print(leftWheelTrainMotor.temperature(u));
-    vexBrain.Screen.newLine();
-
-    //Function motors
-    vexBrain.Screen.print("lifttop | ");
-    vexBrain.Screen.print(liftTopMotor.temperature(u));
-    vexBrain.Screen.print("| liftbottom | ");
-    vexBrain.Screen.print(liftBottomMotor.temperature(u));
-    vexBrain.Screen.newLine();
-    vexBrain.Screen.print("| intakeleft | ");
-    vexBrain.Screen.print(intakeLeftMotor.temperature(u));
-    vexBrain.Screen.print("| intakeright | ");
-    vexBrain.Screen.print(intakeRightMotor.temperature(u));
-}
-
-void print_rpm() {
-    vexBrain.Screen.newLine();
-    vexBrain.Screen.print("Motor RPM: ");
-    vexBrain.Screen.newLine();
-    vexBrain.Screen.print("rw : ");
-    vexBrain.Screen.print(rightWheelTrain.getVelocity());
-    vexBrain.Screen.print(" | lw : ");
-    vexBrain.Screen.print(leftWheelTrain.getVelocity());
-    vexBrain.Screen.newLine();
-}
+/* The two snapshot buffers. The newest one is snapshots[published % 2]. */
+static DebugSnapshot snapshots[2];
+static std::atomic<uint32_t> published(0);
 
+void publishDebugSnapshot(const InputFrame &input) {
+    uint32_t next = published.load(std::memory_order_relaxed) + 1;
+    DebugSnapshot &snapshot = snapshots[next % 2];
 
-void resetDebug() {
-    vex::task::sleep(100);
-    vexBrain.Screen.clearLine();
-    vexBrain.Screen.clearScreen();
-    vexBrain.Screen.setOrigin(0, 0);
+    //Switch pages when the button is first pressed (not while it is held)
+    static bool wasShowingLatency = false;
+    static int page = mainPage;
+    if(input.pressing(showLatency) && !wasShowingLatency) {
+        page = (page + 1) % NUM_DEBUG_PAGES;
+    }
+    wasShowingLatency = input.pressing(showLatency);
+
+    snapshot.page = page;
+    snapshot.input = input;
+
+    for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
+        snapshot.wheelVelocities[i] = wheelTrains[i]->getVelocity();
+    }
+
+    //Already read by updateThermal() every couple of seconds, so the motors are not asked again every tick
+    for(int i=0; i<NUM_MOTORS; i++) {
+        double celsius = motorThermals[i].getTemperature();
+        snapshot.temperatures[i] = u == temperatureUnits::fahrenheit ? celsius * 9 / 5 + 32 : celsius;
+        snapshot.secondsToThrottle[i] = motorThermals[i].secondsToThrottle();
+    }
+    snapshot.drivePower = drivePower();
+
+    snapshot.tickPeriod = controlTicker.getLastPeriod();
+    snapshot.tickOverruns = controlTicker.getOverruns();
+    snapshot.tickWorstJitter = controlTicker.getWorstJitter();
+
+    snapshot.motorCommandsSent = CachedMotor::totalSent;
+    snapshot.motorCommandsSuppressed = CachedMotor::totalSuppressed;
+
+    snapshot.telemetry = getTelemetryStats();
+
+    published.store(next, std::memory_order_release);
 }
 
+void readDebugSnapshot(DebugSnapshot &snapshot) {
+    uint32_t newest;
+    do {
+        newest = published.load(std::memory_order_acquire);
+        snapshot = snapshots[newest % 2];
+        //If another snapshot was published, then the buffer we copied may be being rewritten
+    } while(published.load(std::memory_order_acquire) != newest);
+}
 
-void debugMenuController(){
+/* The debug screen task. Lowest priority so that it only draws when nothing else needs to run. */
+static int debugScreenTask() {
+    DebugSnapshot snapshot;
+    int drawnPage = mainPage;
+    bool saved = false;
+    bool wasEnabled = competition::isEnabled();
     resetDebug();
+    while(1) {
+        readDebugSnapshot(snapshot);
+        if(snapshot.page != drawnPage) {
+            resetDebug();
+            drawnPage = snapshot.page;
+            if(drawnPage == latencyPage) { saved = saveLatencyReport(); }
+        }
+
+        //Also keep the latency report from the end of each match
+        bool enabled = competition::isEnabled();
+        if(wasEnabled && !enabled) { saveLatencyReport(); }
+        wasEnabled = enabled;
+
+        if(drawnPage == latencyPage) {
+            latencyStats(saved);
+        } else if(drawnPage == posePage) {
+            poseStats();
+        } else if(drawnPage == safetyPage) {
+            safetyStats();
+        } else if(drawnPage == indexerPage) {
+            indexerStats();
+        } else {
+            debugMenuController(snapshot);
+        }
+        this_thread::sleep_for(DEBUG_REFRESH_TIME);
+    }
+    return 0;
+}
+
+void startDebugScreen() {
+    //Draw something before the first tick is published
+    InputFrame input;
+    sampleInput(input);
+    publishDebugSnapshot(input);
+    task debugTask(debugScreenTask, 1); //1 is the lowest priority
+}
+
+/* The text last drawn on each row of the screen, used to skip rows that have not changed. */
+static char drawnRows[DEBUG_ROWS][DEBUG_COLUMNS + 1];
+
+void drawRow(int row, const char *format, ...) {
+    if(row < 0 || row >= DEBUG_ROWS) { return; }
+
+    char text[DEBUG_COLUMNS + 1];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+
+    char *drawn = drawnRows[row];
+    if(strcmp(text, drawn) == 0) { return; } //Nothing changed
+
+    //Pad with spaces to cover whatever was left of the old text (instead of clearing the line, which flickers)
+    int oldLength = (int)strlen(drawn);
+    int newLength = (int)strlen(text);
+    vexBrain.Screen.setCursor(row + 1, 1);
+    vexBrain.Screen.print("%s%*s", text, oldLength > newLength ? oldLength - newLength : 0, "");
+
+    strcpy(drawn, text);
+}
+
+void leftAnalogStick(const DebugSnapshot &snapshot) {
+    drawRow(0, "Axis 1 | %ld | Axis 2 | %ld", (long)snapshot.input.axis(Axis1), (long)snapshot.input.axis(Axis2));
+}
+
+void rightAnalogStick(const DebugSnapshot &snapshot) {
+    drawRow(1, "Axis 4 | %ld | Axis 3 | %ld", (long)snapshot.input.axis(Axis4), (long)snapshot.input.axis(Axis3));
+}
+
+void buttons(const DebugSnapshot &snapshot) {
+    drawRow(2, "A | %d | B | %d | X | %d | Y | %d",
+        snapshot.input.pressing(ButtonA), snapshot.input.pressing(ButtonB),
+        snapshot.input.pressing(ButtonX), snapshot.input.pressing(ButtonY));
+}
+
+void arrows(const DebugSnapshot &snapshot) {
+    drawRow(3, "v | %d | ^ | %d | > | %d | < | %d",
+        snapshot.input.pressing(ButtonDown), snapshot.input.pressing(ButtonUp),
+        snapshot.input.pressing(ButtonRight), snapshot.input.pressing(ButtonLeft));
+}
 
-    leftAnalogStick();
-    vexBrain.Screen.newLine();
+void bumpers(const DebugSnapshot &snapshot) {
+    drawRow(4, "L1 | %d | L2 | %d | R1 | %d | R2 | %d",
+        snapshot.input.pressing(ButtonL1), snapshot.input.pressing(ButtonL2),
+        snapshot.input.pressing(ButtonR1), snapshot.input.pressing(ButtonR2));
+}
+
+void tickStats(const DebugSnapshot &snapshot) {
+    drawRow(5, "Tick (us) | %lu | overruns | %lu | jitter | %lu", (unsigned long)snapshot.tickPeriod,
+        (unsigned long)snapshot.tickOverruns, (unsigned long)snapshot.tickWorstJitter);
+}
+
+void telemetryStats(const DebugSnapshot &snapshot) {
+    const TelemetryStats &stats = snapshot.telemetry;
+    if(telemetryFile[0] == '\0') {
+        drawRow(6, "Log | off (no SD card)");
+    } else {
+        drawRow(6, "Log | %lu | dropped | %lu full | %lu SD", (unsigned long)stats.recorded,
+            (unsigned long)stats.droppedFull, (unsigned long)stats.droppedWrite);
+    }
+}
+
+void print_rpm(const DebugSnapshot &snapshot) {
+    drawRow(7, "Motor RPM | rw : %d | lw : %d", snapshot.wheelVelocities[0], snapshot.wheelVelocities[1]);
+}
+
+void motorCommands(const DebugSnapshot &snapshot) {
+    drawRow(8, "Motor cmds | sent | %lu | skipped | %lu",
+        (unsigned long)snapshot.motorCommandsSent, (unsigned long)snapshot.motorCommandsSuppressed);
+}
 
-    rightAnalogStick();
-    vexBrain.Screen.newLine();
-    
-    buttons();
-    vexBrain.Screen.newLine();
+/* Writes how long until a motor is throttled as m:ss, "--" or "HOT". */
+static void formatThrottleTime(char *text, size_t size, double seconds) {
+    if(seconds < 0 || seconds >= 6000) { snprintf(text, size, "--"); }
+    else if(seconds == 0) { snprintf(text, size, "HOT"); }
+    else { snprintf(text, size, "%d:%02d", (int)seconds / 60, (int)seconds % 60); }
+}
+
+void temperature(const DebugSnapshot &snapshot) {
+    const char *units = u == temperatureUnits::fahrenheit ? "fahrenheit" : "celcius";
+    drawRow(9, "Motor Temp (%s) | drive power | %d%%", units, (int)(snapshot.drivePower * 100 + 0.5));
+
+    //Same order as allMotors: the wheels, then the intake, then the lift
+    char times[NUM_MOTORS][16];
+    for(int i=0; i<NUM_MOTORS; i++) {
+        formatThrottleTime(times[i], sizeof(times[i]), snapshot.secondsToThrottle[i]);
+    }
+    const double *t = snapshot.temperatures;
+    drawRow(10, "rw | %.1f (%s) | lw | %.1f (%s)", t[0], times[0], t[1], times[1]);
+    drawRow(11, "intake | %.1f (%s) | %.1f (%s)", t[2], times[2], t[3], times[3]);
+    drawRow(12, "lift | %.1f (%s) | %.1f (%s)", t[4], times[4], t[5], times[5]);
+}
+
+void latencyStats(bool saved) {
+    char report[768];
+    formatLatencyReport(report, sizeof(report));
+
+    //One line of the report per row
+    int row = 0;
+    for(char *line = report; *line != '\0' && row < DEBUG_ROWS - 2; row++) {
+        char *end = strchr(line, '\n');
+        if(end) { *end = '\0'; }
+        drawRow(row, "%s", line);
+        line = end ? end + 1 : line + strlen(line);
+    }
+
+    drawRow(DEBUG_ROWS - 2, saved ? "Saved to SD card as %s" : "No SD card, %s not saved", LATENCY_REPORT_FILE);
+    drawRow(DEBUG_ROWS - 1, "Press Y for the position page");
+}
+
+void poseStats() {
+    Pose pose = getRobotPose();
+    double heading = fmod(pose.heading, 360.0);
+    if(heading < 0) { heading += 360.0; }
+
+    drawRow(0, "Position (inches from the start)");
+    drawRow(1, "x | %.1f | y | %.1f", pose.x, pose.y);
+    drawRow(2, "Heading | %.1f deg | total | %.1f deg", heading, pose.heading);
+    drawRow(3, "Speed | %.1f in/s | turning | %.1f deg/s", pose.velocity, pose.angularVelocity);
+    if(inertialSensor.isCalibrating()) {
+        drawRow(4, "Inertial | calibrating (encoders only)");
+    } else {
+        drawRow(4, "Inertial | %.1f deg", inertialSensor.heading(degrees));
+    }
+    drawRow(5, "Update (us) | %lu | worst | %lu",
+        (unsigned long)odometryUpdateTime, (unsigned long)odometryWorstUpdateTime);
+    drawRow(DEBUG_ROWS - 1, "Press Y for the safety page");
+}
+
+/* Draws one stall from the watchdog (see watchdog.h). */
+static void stallRow(int row, const char *label, const StallRecord &stall) {
+    if(stall.name == nullptr) {
+        drawRow(row, "%s | none", label);
+    } else {
+        drawRow(row, "%s | %s | %lu ms | at %.1f s", label, stall.name, (unsigned long)(stall.duration / 1000),
+            stall.time / 1000.0);
+    }
+}
+
+void safetyStats() {
+    WatchdogStats watchdog = getWatchdogStats();
+
+    drawRow(0, "E-stop (B) | %s | late | %lu | limit %d ms", isEmergencyStopped() ? "STOPPED" : "ready",
+        (unsigned long)getEmergencyStopsLate(), EMERGENCY_STOP_LIMIT);
+    if(watchdog.stalled != nullptr) {
+        drawRow(1, "Watchdog | STALLED: %s | stalls | %lu", watchdog.stalled, (unsigned long)watchdog.stalls);
+    } else {
+        drawRow(1, "Watchdog | ok | stalls | %lu", (unsigned long)watchdog.stalls);
+    }
+    stallRow(2, "Last stall", watchdog.last);
+    stallRow(3, "Longest", watchdog.longest);
+    drawRow(4, "Cmd queue | dropped | %lu", (unsigned long)actuatorQueue.getDropped());
+    drawRow(5, "Battery | %.2f V | lowest | %.2f V | x%.2f", batteryVoltage(), lowestBatteryVoltage(), batteryScale());
+    TractionControl &right = rightWheelTrain.getTraction(), &left = leftWheelTrain.getTraction();
+    drawRow(6, "Traction | slips | rw %lu%s | lw %lu%s", (unsigned long)right.getSlips(), right.isSlipping() ? " SLIP" : "",
+        (unsigned long)left.getSlips(), left.isSlipping() ? " SLIP" : "");
+    drawRow(DEBUG_ROWS - 1, "Press Y for the indexer page");
+}
+
+void indexerStats() {
+    static const char *const STAGE_NAMES[NUM_BALL_STAGES] = {"mouth", "lift", "top"};
+    IndexerStats stats = getIndexerStats();
+
+    if(!mouthSensor.installed() || !topSensor.installed()) {
+        drawRow(0, "Indexer | off (no sensors)");
+    } else {
+        drawRow(0, "Indexer | %s | balls | %d of %d", ballIndexing ? "on" : "off", stats.balls, MAX_BALLS);
+    }
+    for(int i=0; i<MAX_TRACKED_BALLS; i++) {
+        if(i < stats.balls) {
+            drawRow(1 + i, "Ball %d | %s | %.1f in", i + 1, STAGE_NAMES[stats.stages[i]], stats.positions[i]);
+        } else {
+            drawRow(1 + i, "Ball %d | -", i + 1);
+        }
+    }
+    drawRow(6, "Collected | %lu | scored | %lu | expelled | %lu", (unsigned long)stats.collected,
+        (unsigned long)stats.scored, (unsigned long)stats.expelled);
+    drawRow(7, "Cycling | %.2f balls/s", stats.ballsPerSecond);
+    drawRow(8, "Held (ms) | mouth %.0f | lift %.0f | top %.0f", stats.stageTimes[mouthStage],
+        stats.stageTimes[liftStage], stats.stageTimes[topStage]);
+    drawRow(DEBUG_ROWS - 1, "Press Y to go back");
+}
+
+void resetDebug() {
+    vexBrain.Screen.clearScreen();
+    vexBrain.Screen.setOrigin(0, 0);
+    for(int row=0; row<DEBUG_ROWS; row++) {
+        drawnRows[row][0] = '\0';
+    }
+}
 
-    arrows();
-    vexBrain.Screen.newLine();
 
-    bumpers();
-    vexBrain.Screen.newLine();
+void debugMenuController(const DebugSnapshot &snapshot){
+    leftAnalogStick(snapshot);
+    rightAnalogStick(snapshot);
+    buttons(snapshot);
+    arrows(snapshot);
+    bumpers(snapshot);
+    this_thread::yield();
 
-    print_rpm();
-    vexBrain.Screen.newLine();
+    tickStats(snapshot);
+    telemetryStats(snapshot);
+    print_rpm(snapshot);
+    motorCommands(snapshot);
+    this_thread::yield();
 
-    temperature();
-    vexBrain.Screen.newLine();
+    temperature(snapshot);
 }
 
 void number(double numb) { //Use this to get numbers
@@ -0,0 +1,136 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       driveMoves.cpp                                                  */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Autonomous Drive Move Implementation                            */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include <cmath>
+
+using namespace vex;
+
+#include "driveMoves.h"
+#include "functionality.h"
+#include "odometry.h"
+
+static const double RADIANS_PER_DEGREE = M_PI / 180.0;
+
+double approachSpeed(double distance, int speed) {
+    double braking = AUTONOMOUS_LIMITS.maxAcceleration * MOVE_BRAKING * INCHES_PER_SECOND_PER_RPM;
+    double rpm = sqrt(2 * braking * fabs(distance)) / INCHES_PER_SECOND_PER_RPM;
+    double approach = fabs(distance) / MOVE_APPROACH_TIME / INCHES_PER_SECOND_PER_RPM;
+    if(rpm > approach) { rpm = approach; }
+    if(rpm > speed) { rpm = speed; }
+    return distance < 0 ? -rpm : rpm;
+}
+
+/* An angle moved into -180 to 180 degrees. */
+static double wrapDegrees(double degrees) {
+    degrees = fmod(degrees + 180.0, 360.0);
+    if(degrees < 0) { degrees += 360.0; }
+    return degrees - 180.0;
+}
+
+/*--------------------------------- Drive Moves -----------------------------------*/
+
+void DriveMove::setDriveGoals(double left, double right) {
+    leftWheelTrain.setGoalVelocity((int)lround(left));
+    rightWheelTrain.setGoalVelocity((int)lround(right));
+}
+
+void DriveMove::begin() {
+    start = timer::system();
+    inside = false;
+    reached = false;
+    startMove(getRobotPose());
+}
+
+bool DriveMove::step(const Pose &pose) {
+    double remaining = drive(pose);
+
+    uint32_t now = timer::system();
+    if(fabs(remaining) <= exit.tolerance) {
+        if(!inside) { insideSince = now; }
+        inside = true;
+        if(now - insideSince >= (uint32_t)exit.settleTime) {
+            reached = true;
+            return true;
+        }
+    } else {
+        inside = false;
+    }
+    return now - start >= (uint32_t)exit.timeout;
+}
+
+void DriveMove::end() {
+    for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
+        wheelTrains[i]->setVelocity(0);
+        wheelTrains[i]->stop(brake);
+    }
+}
+
+void DriveDistance::startMove(const Pose &pose) {
+    start = pose;
+}
+
+double DriveDistance::drive(const Pose &pose) {
+    //Only the distance along the starting heading counts
+    double headingRadians = start.heading * RADIANS_PER_DEGREE;
+    double travelled = (pose.x - start.x) * sin(headingRadians) + (pose.y - start.y) * cos(headingRadians);
+    double remaining = inches - travelled;
+    double velocity = fabs(remaining) <= exit.tolerance ? 0 : approachSpeed(remaining, speed);
+    double correction = HEADING_CORRECTION * (pose.heading - start.heading);
+    setDriveGoals(velocity - correction, velocity + correction);
+    return remaining;
+}
+
+double TurnToHeading::drive(const Pose &pose) {
+    double remaining = wrapDegrees(target - pose.heading);
+    //Each wheel goes round a circle the width of the robot
+    double wheelDistance = remaining * RADIANS_PER_DEGREE * TRACK_WIDTH / 2;
+    double velocity = fabs(remaining) <= exit.tolerance ? 0 : approachSpeed(wheelDistance, speed);
+    setDriveGoals(velocity, -velocity);
+    return remaining;
+}
+
+void DriveArc::startMove(const Pose &pose) {
+    target = pose.heading + degrees * MIRROR;
+}
+
+double DriveArc::drive(const Pose &pose) {
+    double outside = (radius + TRACK_WIDTH / 2) / radius;
+    double inside = (radius - TRACK_WIDTH / 2) / radius;
+    double remaining = target - pose.heading;
+    //The speed of the middle of the robot, so that the outside wheels never go faster than `speed`
+    double velocity = fabs(remaining) <= exit.tolerance ? 0
+        : fabs(approachSpeed(radius * remaining * RADIANS_PER_DEGREE, (int)(speed / outside)));
+    if(remaining > 0) {
+        setDriveGoals(velocity * outside, velocity * inside); //Curving right, so the left wheels are outside
+    } else {
+        setDriveGoals(velocity * inside, velocity * outside);
+    }
+    return remaining;
+}
+
+/*-------------------------------- Blocking Moves ---------------------------------*/
+
+bool driveDistance(double inches, int speed, ExitConditions exit) {
+    DriveDistance move(inches, speed, exit);
+    runAction(move);
+    return move.succeeded();
+}
+
+bool turnToHeading(double heading, int speed, ExitConditions exit) {
+    TurnToHeading move(heading, speed, exit);
+    runAction(move);
+    return move.succeeded();
+}
+
+bool driveArc(double radius, double degrees, int speed, ExitConditions exit) {
+    DriveArc move(radius, degrees, speed, exit);
+    runAction(move);
+    return move.succeeded();
+}
@@ -0,0 +1,53 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       emergencyStop.cpp                                               */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Emergency Stop Watchdog Implementation                          */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "emergencyStop.h"
+#include "functionality.h"
+#include "latency.h"
+#include "ticker.h"
+
+static Ticker emergencyStopTicker(EMERGENCY_STOP_PERIOD, "e-stop");
+
+/* Only written by the emergency stop task. */
+static uint32_t stopsLate = 0;
+
+bool isEmergencyStopped() { return CachedMotor::isHalted(emergencyStopHalt); }
+
+uint32_t getEmergencyStopsLate() { return stopsLate; }
+
+/* The emergency stop task. Highest priority, so nothing but the other quick high priority tasks can hold it up. */
+static int emergencyStopTask() {
+    uint64_t lastLetGo = timer::systemHighResolution();
+    emergencyStopTicker.start();
+    while(1) {
+        uint64_t sampled = timer::systemHighResolution();
+        bool pressing = stopMotors.pressing();
+
+        if(pressing && !isEmergencyStopped()) {
+            emergencyStop();
+            uint32_t latency = (uint32_t)(timer::systemHighResolution() - lastLetGo);
+            stopLatencyHistogram.record(latency);
+            if(latency > (uint32_t)EMERGENCY_STOP_LIMIT * 1000) { stopsLate++; }
+        } else if(!pressing && isEmergencyStopped()) {
+            resumeMotors(emergencyStopHalt);
+        }
+
+        if(!pressing) { lastLetGo = sampled; }
+        emergencyStopTicker.waitForNextTick();
+    }
+    return 0;
+}
+
+void startEmergencyStop() {
+    task emergencyStopper(emergencyStopTask, task::taskPriorityHigh);
+}
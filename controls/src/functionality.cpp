@@ -15,22 +15,24 @@ using namespace vex;
 #include "functionality.h"
 #include "debugScreen.h"
 
-/* WHEEL GRADUAL ACCELERATION (Acceleration constant, velocity increasing to desired speed)
+/* WHEEL GRADUAL ACCELERATION (velocity increasing to desired speed)
  *    When the robot is first supposed to move (when the analog stick is moved),
  * the robot's wheels immediately go to an extremely high velocity (upwards of
  * 200 rpm). Just like in a car, if you try to accelerate too fast, this can
  * cause unwanted drifting (more like skidding). We have kinetic friction but
  * want static friction between the wheels and the ground.
  *
- *    To fix this, we may be able to "gradually" accelerate to the desired speed
- * (the jerk would still be very high). We must use a linear model so that the
- * ratio between the wheel's velocity remains the same. If it does not, then
- * the robot will move in a direction we do not want.
+ *    To fix this, each wheel follows an S-curve to its goal velocity (see
+ * motionProfile.h), which limits both the acceleration and the jerk. The ratio
+ * between the wheels' velocities must stay the same while they accelerate. If
+ * it does not, then the robot will move in a direction we do not want, so
+ * in updateWheels() only the wheel with the furthest to go follows its
+ * S-curve, and the others keep in proportion with it.
 */
 
 //We're gonna have to change the velocity of all the wheels by taking
 //the value of both left and right analog sticks.
-void movement(int forward, int turnValue) {
+void setWheelGoals(int forward, int turnValue) {
 
     int leftWheels = 0;
     int rightWheels = 0;
@@ -56,17 +58,41 @@ void movement(int forward, int turnValue) {
         }
     }
     
-    leftWheelTrain.setVelocity(leftWheels);
-    rightWheelTrain.setVelocity(rightWheels);
-    if(leftWheelTrain.getVelocity() == 0) {
-        leftWheelTrainMotor.stop(brake);
-    } else {
-        leftWheelTrain.spin(vex::forward);  
+    leftWheelTrain.setGoalVelocity(leftWheels);
+    rightWheelTrain.setGoalVelocity(rightWheels);
+}
+
+void updateWheels() {
+    //The wheel with the furthest to go leads, and the others go the same part of the way as it does
+    int leader = 0;
+    int furthest = -1;
+    for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
+        int distance = abs(wheelTrains[i]->getGoalVelocity() - wheelTrains[i]->getVelocity());
+        if(distance > furthest) {
+            furthest = distance;
+            leader = i;
+        }
     }
-    if(rightWheelTrain.getVelocity() == 0) {
-        rightWheelTrainMotor.stop(brake);
-    } else {
-        rightWheelTrain.spin(vex::forward);
+
+    wheelTrains[leader]->updateVelocity();
+    for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
+        if(i != leader) {
+            wheelTrains[i]->followVelocity(wheelTrains[leader]->getProgress());
+        }
+    }
+}
+
+void movement(int forward, int turnValue) {
+    setWheelGoals(forward, turnValue);
+    updateWheels();
+}
+
+void movement(const InputFrame &input) {
+    //The response curves are worked out ahead of time (see stickCurves.h), so this is just two lookups
+    movement(forwardTables[driverProfile][speedMode][input.axis(forwardAxis)],
+        turningTables[driverProfile][speedMode][input.axis(turningAxis)]);
+    for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
+        wheelTrains[i]->stampInput(input.time); //So the wheel control task can time how long the sticks take to reach the motors
     }
 }
 
@@ -75,40 +101,49 @@ void movement(int forward, int turnValue) {
 */
 void intakeMotors(int dir) {
     if(dir == expel) { //Down
-        intakeLeftMotor.spin(reverse);
-        intakeRightMotor.spin(reverse);
+        intakeLeft.spin(reverse);
+        intakeRight.spin(reverse);
     } else if(dir == stopIntake) { //Stop
-        intakeLeftMotor.stop(hold);
-        intakeRightMotor.stop(hold);
+        intakeLeft.stop(hold);
+        intakeRight.stop(hold);
     } else if(dir == intake) { //Up
-        intakeLeftMotor.spin(forward);
-        intakeRightMotor.spin(forward);
+        intakeLeft.spin(forward);
+        intakeRight.spin(forward);
     }
 }
 
 void liftMotors(int dir) {
     if(dir == down) { //Down
-        liftTopMotor.spin(forward);
-        liftBottomMotor.spin(forward);
+        liftTop.spin(forward);
+        liftBottom.spin(forward);
     } else if(dir == stopLift) { //Stop
-        liftTopMotor.stop(hold);
-        liftBottomMotor.stop(hold);
+        liftTop.stop(hold);
+        liftBottom.stop(hold);
     } else if(dir == up) { //Up
-        liftTopMotor.spin(reverse);
-        liftBottomMotor.spin(reverse);
+        liftTop.spin(reverse);
+        liftBottom.spin(reverse);
     }
 }
 
 /*
  * Immediately stop all motors and brake them
 */
-void emergencyStop() {
-    rightWheelTrain.setVelocity(0);
-    leftWheelTrain.setVelocity(0);
-    rightWheelTrainMotor.stop(brake);
-    leftWheelTrainMotor.stop(brake);
-    liftTopMotor.stop(brake);
-    liftTopMotor.stop(brake);
-    intakeLeftMotor.stop(brake);
-    intakeRightMotor.stop(brake);
+void emergencyStop(uint32_t reason) {
+    CachedMotor::halt(reason); //Nothing else gets through to the motors until resumeMotors()
+    for(int i=0; i<NUM_MOTORS; i++) {
+        //The cache might think a motor is already stopped, but a runaway motor is exactly one not doing what it was told
+        allMotors[i]->invalidate();
+        allMotors[i]->stop(brake);
+    }
+    for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
+        wheelTrains[i]->setVelocity(0);
+    }
+}
+
+void resumeMotors(uint32_t reason) {
+    if(!CachedMotor::isHalted(reason)) { return; }
+    for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
+        wheelTrains[i]->setVelocity(0);
+    }
+    CachedMotor::resume(reason);
 }
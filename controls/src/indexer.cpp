@@ -0,0 +1,225 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       indexer.cpp                                                     */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Ball Indexing Implementation                                    */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "indexer.h"
+#include "functionality.h"
+
+bool ballIndexing = true;
+
+/* One ball in the robot: inches on from the mouth sensor, where it is (from `ballStages`) and since when (ms). */
+struct Ball {
+    double position;
+    int stage;
+    uint32_t since;
+};
+
+/* Only touched by the control loop. The ball nearest the top is first. */
+static Ball balls[MAX_TRACKED_BALLS];
+static int count = 0;
+
+static bool started = false;
+static double lastIntakeTurns = 0, lastLiftTurns = 0;
+static bool sawMouth = false, sawTop = false;
+
+static uint32_t collected = 0, scored = 0, expelled = 0;
+static uint32_t lastScore = 0, cycles = 0, cycleTime = 0;
+static double stageTotals[NUM_BALL_STAGES] = {};
+static uint32_t stageBalls[NUM_BALL_STAGES] = {};
+
+/* Puts a ball in at `index` (moving the ones behind it back), if there is room. */
+static void addBall(int index, double position, int stage, uint32_t now) {
+    if(count >= MAX_TRACKED_BALLS) { return; }
+    for(int i=count; i>index; i--) { balls[i] = balls[i-1]; }
+    balls[index].position = position;
+    balls[index].stage = stage;
+    balls[index].since = now;
+    count++;
+}
+
+static void removeBall(int index) {
+    for(int i=index; i<count-1; i++) { balls[i] = balls[i+1]; }
+    count--;
+}
+
+/* Moves a ball on to its next stage, counting how long it was held at the last one. */
+static void advance(Ball &ball, int stage, uint32_t now) {
+    stageTotals[ball.stage] += now - ball.since;
+    stageBalls[ball.stage]++;
+    ball.stage = stage;
+    ball.since = now;
+}
+
+/* Puts a ball back a stage (brought down by the driver), without counting it. */
+static void goBack(Ball &ball, int stage, uint32_t now) {
+    ball.stage = stage;
+    ball.since = now;
+}
+
+/* Carries the balls along by however far the intake and lift turned, as far as they can go. */
+static void carryBalls(double intakeMoved, double liftMoved) {
+    for(int i=0; i<count; i++) {
+        Ball &ball = balls[i];
+        ball.position += ball.position < LIFT_ENTRY ? intakeMoved : liftMoved;
+        //Never into the ball ahead, and never past a sensor without it seeing the ball go
+        if(i > 0 && ball.position > balls[i-1].position - BALL_DIAMETER) { ball.position = balls[i-1].position - BALL_DIAMETER; }
+        if(ball.stage == mouthStage) {
+            ball.position = fmax(fmin(ball.position, SENSOR_REACH), -SENSOR_REACH);
+        } else if(ball.stage == topStage) {
+            ball.position = fmax(fmin(ball.position, TOP_POSITION + SENSOR_REACH), TOP_POSITION - SENSOR_REACH);
+        } else if(ball.position < SENSOR_REACH) {
+            ball.position = SENSOR_REACH;
+        }
+    }
+}
+
+/* How far the intake can take a ball in: into the lift, or up to the ball ahead of it if that is still in the intake. */
+static double intakeLimit(int index) {
+    if(index == 0) { return LIFT_ENTRY; }
+    return fmin(LIFT_ENTRY, balls[index-1].position - BALL_DIAMETER - PACKED_MARGIN);
+}
+
+/*
+ * Where the ball nearest the top waits: as high as leaves room behind it for
+ * the rest of MAX_BALLS, one ball apart, so that they pack in right behind it
+ * and are scored one straight after another. Once full, at the top.
+*/
+static double stagingPosition() {
+    int room = MAX_BALLS - count;
+    return TOP_POSITION - (room > 0 ? room : 0) * BALL_DIAMETER;
+}
+
+void indexBalls(int &lift, int &intaking) {
+    if(!mouthSensor.installed() || !topSensor.installed()) { return; }
+    uint32_t now = timer::system();
+    double intakeTurns = intakeRightMotor.position(turns);
+    double liftTurns = -liftTopMotor.position(turns); //The lift goes up with its motors in reverse (see liftMotors())
+    bool mouth = mouthSensor.isNearObject();
+    bool top = topSensor.isNearObject();
+    if(!started) {
+        lastIntakeTurns = intakeTurns;
+        lastLiftTurns = liftTurns;
+        started = true;
+    }
+    double intakeMoved = (intakeTurns - lastIntakeTurns) * INTAKE_INCHES_PER_TURN;
+    double liftMoved = (liftTurns - lastLiftTurns) * LIFT_INCHES_PER_TURN;
+    lastIntakeTurns = intakeTurns;
+    lastLiftTurns = liftTurns;
+    carryBalls(intakeMoved, liftMoved);
+
+    //A ball seen at the mouth is a new one, unless the last one was just brought back down to it
+    if(mouth && !sawMouth) {
+        if(intakeMoved < 0 && count > 0 && balls[count-1].stage == liftStage && balls[count-1].position < BALL_DIAMETER) {
+            goBack(balls[count-1], mouthStage, now);
+        } else {
+            addBall(count, -SENSOR_REACH, mouthStage, now);
+        }
+    } else if(!mouth && sawMouth && count > 0 && balls[count-1].stage == mouthStage) {
+        Ball &ball = balls[count-1];
+        if(intakeMoved > 0) {
+            ball.position = fmax(ball.position, SENSOR_REACH);
+            advance(ball, liftStage, now);
+            collected++;
+        } else {
+            if(intakeMoved < 0) { expelled++; }
+            removeBall(count-1); //Pushed (or rolled) back out
+        }
+    }
+
+    //The ball nearest the top reached it (or one was put in the robot by hand, like the preload)
+    if(top && !sawTop) {
+        if(count > 0 && balls[0].stage == liftStage) {
+            balls[0].position = TOP_POSITION - SENSOR_REACH;
+            advance(balls[0], topStage, now);
+        } else if(count == 0 || balls[0].stage == mouthStage) {
+            addBall(0, TOP_POSITION, topStage, now);
+        }
+    } else if(!top && sawTop && count > 0 && balls[0].stage == topStage) {
+        if(liftMoved >= 0) {
+            if(lastScore != 0 && now - lastScore < CYCLE_GAP) {
+                cycleTime += now - lastScore;
+                cycles++;
+            }
+            lastScore = now;
+            advance(balls[0], topStage, now); //Only to count how long it waited at the top
+            removeBall(0);
+            scored++;
+        } else {
+            goBack(balls[0], liftStage, now);
+        }
+    }
+
+    //Carried well past the top without the sensor ever seeing it, so it was never really there
+    if(count > 0 && balls[0].stage == liftStage && balls[0].position > TOP_POSITION + BALL_DIAMETER) { removeBall(0); }
+    sawMouth = mouth;
+    sawTop = top;
+
+    if(!ballIndexing) { return; }
+    bool scoring = lift == up;
+
+    //Bring the balls up to their staging positions once the last one has come in as far as it can, unless the driver
+    //is scoring (or bringing the balls down)
+    if(lift == stopLift && count > 0 && balls[0].position < stagingPosition()
+        && balls[count-1].position >= intakeLimit(count-1) - PACKED_MARGIN) {
+        lift = up;
+    }
+
+    //Take balls in as far as they can go, and keep the ones in the intake going up with the lift, unless the driver
+    //is bringing the balls down (which leaves room behind them that must not be filled)
+    if(intaking != expel && lift != down) {
+        bool room = false, feeding = false;
+        for(int i=0; i<count; i++) {
+            if(balls[i].stage == topStage) { continue; }
+            if(balls[i].position < intakeLimit(i)) { room = true; }
+            if(lift == up && balls[i].position < LIFT_ENTRY) { feeding = true; }
+        }
+        if(room || feeding) {
+            intaking = intake;
+        } else if(intaking == intake && count >= MAX_BALLS && !scoring) {
+            intaking = stopIntake; //Full, and nothing is being scored to make room
+        }
+    }
+}
+
+IndexerStats getIndexerStats() {
+    IndexerStats stats;
+    stats.balls = count;
+    for(int i=0; i<count; i++) {
+        stats.stages[i] = balls[i].stage;
+        stats.positions[i] = balls[i].position;
+    }
+    stats.collected = collected;
+    stats.scored = scored;
+    stats.expelled = expelled;
+    stats.ballsPerSecond = cycleTime > 0 ? cycles * 1000.0 / cycleTime : 0;
+    for(int i=0; i<NUM_BALL_STAGES; i++) {
+        stats.stageTimes[i] = stageBalls[i] > 0 ? stageTotals[i] / stageBalls[i] : 0;
+    }
+    return stats;
+}
+
+void resetIndexer() {
+    count = 0;
+    started = false;
+    sawMouth = false;
+    sawTop = false;
+    collected = 0;
+    scored = 0;
+    expelled = 0;
+    lastScore = 0;
+    cycles = 0;
+    cycleTime = 0;
+    for(int i=0; i<NUM_BALL_STAGES; i++) {
+        stageTotals[i] = 0;
+        stageBalls[i] = 0;
+    }
+}
@@ -0,0 +1,44 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       input.cpp                                                       */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Per Tick Controller Input Implementation                        */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "input.h"
+
+void sampleInput(InputFrame &frame) {
+    frame.time = timer::systemHighResolution();
+
+    frame.axes[Axis1] = mainCon.Axis1.value();
+    frame.axes[Axis2] = mainCon.Axis2.value();
+    frame.axes[Axis3] = mainCon.Axis3.value();
+    frame.axes[Axis4] = mainCon.Axis4.value();
+
+    //Same order as InputButton
+    bool pressing[NUM_BUTTONS] = {
+        mainCon.ButtonL1.pressing(),
+        mainCon.ButtonL2.pressing(),
+        mainCon.ButtonR1.pressing(),
+        mainCon.ButtonR2.pressing(),
+        mainCon.ButtonUp.pressing(),
+        mainCon.ButtonDown.pressing(),
+        mainCon.ButtonLeft.pressing(),
+        mainCon.ButtonRight.pressing(),
+        mainCon.ButtonX.pressing(),
+        mainCon.ButtonB.pressing(),
+        mainCon.ButtonY.pressing(),
+        mainCon.ButtonA.pressing()
+    };
+
+    frame.buttons = 0;
+    for(int i=0; i<NUM_BUTTONS; i++) {
+        if(pressing[i]) { frame.buttons |= 1u << i; }
+    }
+}
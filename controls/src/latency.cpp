@@ -0,0 +1,131 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       latency.cpp                                                     */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Control Loop Latency Instrumentation Implementation             */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "latency.h"
+#include "ticker.h"
+
+Histogram tickPeriodHistogram;
+Histogram tickJitterHistogram;
+Histogram tickWorkHistogram;
+Histogram inputLatencyHistogram;
+Histogram movementTimeHistogram;
+Histogram commandLatencyHistogram;
+Histogram commandDepthHistogram;
+Histogram stopLatencyHistogram;
+Histogram stallDetectionHistogram;
+Histogram watchdogCheckHistogram;
+
+int Histogram::bucketOf(uint32_t value) {
+    if(value < SUB_BUCKETS) { return (int)value; }
+    int highestBit = 31 - __builtin_clz(value);
+    int sub = (int)((value >> (highestBit - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+    return (highestBit - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + sub;
+}
+
+uint32_t Histogram::bucketMiddle(int bucket) {
+    if(bucket < SUB_BUCKETS) { return (uint32_t)bucket; }
+    int highestBit = bucket / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    int shift = highestBit - SUB_BUCKET_BITS;
+    uint64_t bottom = (uint64_t)(SUB_BUCKETS + bucket % SUB_BUCKETS) << shift;
+    uint64_t middle = bottom + ((uint64_t)1 << shift) / 2;
+    return middle > UINT32_MAX ? UINT32_MAX : (uint32_t)middle;
+}
+
+void Histogram::clear() {
+    for(int i=0; i<NUM_BUCKETS; i++) { counts[i] = 0; }
+    total = 0;
+    smallest = UINT32_MAX;
+    largest = 0;
+    sum = 0;
+}
+
+void Histogram::record(uint32_t value) {
+    counts[bucketOf(value)]++;
+    total++;
+    sum += value;
+    if(value < smallest) { smallest = value; }
+    if(value > largest) { largest = value; }
+}
+
+uint32_t Histogram::percentile(int percent) const {
+    if(total == 0) { return 0; }
+    //The number of values that have to be at or below the answer (rounded up)
+    uint64_t needed = ((uint64_t)total * percent + 99) / 100;
+    uint64_t seen = 0;
+    for(int i=0; i<NUM_BUCKETS; i++) {
+        seen += counts[i];
+        if(seen >= needed && seen > 0) {
+            uint32_t middle = bucketMiddle(i);
+            if(middle < smallest) { return smallest; }
+            return middle < largest ? middle : largest;
+        }
+    }
+    return largest;
+}
+
+void recordControlTick(uint64_t movementStart) {
+    uint64_t now = timer::systemHighResolution();
+    movementTimeHistogram.record((uint32_t)(now - movementStart));
+
+    if(controlTicker.getTicks() > 0) {
+        uint32_t period = controlTicker.getLastPeriod();
+        uint32_t nominal = controlTicker.getPeriod();
+        tickPeriodHistogram.record(period);
+        tickJitterHistogram.record(period > nominal ? period - nominal : nominal - period);
+        tickWorkHistogram.record(controlTicker.getLastWork()); //Of the tick before this one
+    }
+}
+
+void clearLatencyStats() {
+    tickPeriodHistogram.clear();
+    tickJitterHistogram.clear();
+    tickWorkHistogram.clear();
+    inputLatencyHistogram.clear();
+    movementTimeHistogram.clear();
+    commandLatencyHistogram.clear();
+    commandDepthHistogram.clear();
+    stopLatencyHistogram.clear();
+    stallDetectionHistogram.clear();
+    watchdogCheckHistogram.clear();
+}
+
+static int formatHistogram(char *text, int size, const char *name, const Histogram &histogram) {
+    int length = snprintf(text, size, "%-10s %6lu %6lu %6lu %6lu %6lu\n", name, (unsigned long)histogram.count(),
+        (unsigned long)histogram.percentile(50), (unsigned long)histogram.percentile(95),
+        (unsigned long)histogram.percentile(99), (unsigned long)histogram.max());
+    return length < size ? length : size - 1;
+}
+
+int formatLatencyReport(char *text, int size) {
+    int length = snprintf(text, size, "%-10s %6s %6s %6s %6s %6s\n", "(us)", "n", "p50", "p95", "p99", "max");
+    if(length >= size) { return size - 1; }
+    length += formatHistogram(text + length, size - length, "tick", tickPeriodHistogram);
+    length += formatHistogram(text + length, size - length, "jitter", tickJitterHistogram);
+    length += formatHistogram(text + length, size - length, "tick work", tickWorkHistogram);
+    length += formatHistogram(text + length, size - length, "input>cmd", inputLatencyHistogram);
+    length += formatHistogram(text + length, size - length, "movement", movementTimeHistogram);
+    length += formatHistogram(text + length, size - length, "cmd wait", commandLatencyHistogram);
+    length += formatHistogram(text + length, size - length, "cmd depth", commandDepthHistogram);
+    length += formatHistogram(text + length, size - length, "e-stop", stopLatencyHistogram);
+    length += formatHistogram(text + length, size - length, "stall det", stallDetectionHistogram);
+    length += formatHistogram(text + length, size - length, "watchdog", watchdogCheckHistogram);
+    return length;
+}
+
+bool saveLatencyReport() {
+    if(!vexBrain.SDcard.isInserted()) { return false; }
+    char text[768];
+    int length = formatLatencyReport(text, sizeof(text));
+    vexBrain.SDcard.savefile(LATENCY_REPORT_FILE, (uint8_t *)text, length);
+    return true;
+}
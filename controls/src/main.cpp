@@ -31,6 +31,7 @@ using namespace vex;
  * Turn Left/Right - Right Analog Stick
  * Lift/Intake - Front Right Bumper (R1)
  * Down/Expel - Back Right Bumper (R2)
+ * Emergency Stop (while held) - B
 */
 
 /* Notes:
@@ -41,6 +42,11 @@ using namespace vex;
 #include "functionality.h"
 #include "autonomous.h"
 #include "robot-config.h"
+#include "ticker.h"
+#include "latency.h"
+#include "telemetry.h"
+#include "actuatorCommands.h"
+#include "thermal.h"
 
 //By using this, I will be able to copy the entirety of the code EXCEPT the side.h file and the autonomous.
 //This will allow me to easily copy new code from other programs (the controls program) over here.
@@ -55,41 +61,39 @@ void pre_auton() {
 
 void userControl() {
 
-    //Using lambdas here btw (learn more: https://en.cppreference.com/w/cpp/language/lambda)
-    //Values of all axes are needed so that wheel velocity can be modified accordingly
-    functionUp.pressed([](){liftMotors(up);});
-    functionDown.pressed([](){liftMotors(down);});
-    functionUp.released([](){liftMotors(stopLift);});
-    functionDown.released([](){liftMotors(stopLift);});
-
-    functionIntake.pressed([](){intakeMotors(intake);});
-    functionExpel.pressed([](){intakeMotors(expel);});
-    functionIntake.released([](){intakeMotors(stopIntake);});
-    functionExpel.released([](){intakeMotors(stopIntake);});
-
-    //stopMotors.pressed(emergencyStop);
+    //The function buttons only post what happened, the loop below applies it to the lift and intake (see actuatorCommands.h)
+    registerActuatorButtons();
 
     //Movement is handled by an infinite while loop to ensure that the movement gets updated like it should
     //Sometimes the axis.changed event does not happen even if the axis value does change. Thus, our current solution.
+    for(int i=0; i<NUM_WHEEL_TRAINS; i++) { //Autonomous may have changed them
+        wheelTrains[i]->setLimits(DRIVER_LIMITS);
+    }
+
+    InputFrame input;
+    clearLatencyStats();
+    controlTicker.start();
     while(1) { //Each iteration of this loop is one tick]
-        movement((int)(forwardAxis.value()*(percentOfMaxSpeed)), (int)(turningAxis.value()/2.0)*(percentOfMaxSpeed));
-        //until the desired velocity is reached.
-        /*for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
-            wheelTrains[i]->calculateAcceleratingVelocity();
-        }*/
-        wait(TICK_LENGTH, msec); //Use less battery this way
-
-        //Speed control using left bumper
-        //If both up and down are pressed, then nothing changess
-        if (speedUp.pressing()) {
-            percentOfMaxSpeed = .40;
-            if (percentOfMaxSpeed > 100) percentOfMaxSpeed = 100;
-        } if (speedDown.pressing()) {
-            percentOfMaxSpeed = .20;
-            if (percentOfMaxSpeed < 0) percentOfMaxSpeed = 0;
+        sampleInput(input); //The controller is read once per tick, everything below uses this
+        applyActuatorCommands(); //The only place the lift and intake are set, from the buttons held
+        updateThermal(); //Derates motors that are getting hot (only reads them every couple of seconds)
+
+        uint64_t movementStart = timer::systemHighResolution();
+        movement(input);
+        recordControlTick(movementStart);
+        recordTelemetry(input, false); //Only queued here, the telemetry task writes it to the SD card
+
+        //Speed control using the arrows
+        //If both up and down are pressed, then slow wins
+        if (input.pressing(speedUp)) {
+            speedMode = fastSpeed;
+        } if (input.pressing(speedDown)) {
+            speedMode = slowSpeed;
         }
 
-        debugMenuController(); //Debug screen is updated every tick
+        publishDebugSnapshot(input); //Debug screen task draws the newest snapshot on its own time
+
+        controlTicker.waitForNextTick(); //Use less battery this way (and keep a constant tick rate)
     }
 
 }
@@ -125,4 +129,5 @@ int main() {
     }
     //*/
 
+    return 0;
 }
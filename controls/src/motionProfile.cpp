@@ -0,0 +1,84 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       motionProfile.cpp                                               */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Acceleration and Jerk Limited Velocity Profile Implementation   */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "motionProfile.h"
+
+/* a * b for 16.16 numbers. */
+static int32_t multiply(int32_t a, int32_t b) {
+    return (int32_t)(((int64_t)a * b) >> 16);
+}
+
+MotionProfile::MotionProfile(ProfileLimits limits, int tickLength) {
+    this->tickLength = tickLength;
+    setLimits(limits);
+}
+
+void MotionProfile::setLimits(ProfileLimits limits) {
+    //rpm/s to rpm/tick, and rpm/s^2 to rpm/tick^2
+    accelerationStep = (int32_t)((int64_t)limits.maxAcceleration * ONE * tickLength / 1000);
+    jerkStep = (int32_t)((int64_t)limits.maxJerk * ONE * tickLength / 1000 * tickLength / 1000);
+}
+
+void MotionProfile::reset(int velocity) {
+    this->velocity = velocity * ONE;
+    acceleration = 0;
+}
+
+int MotionProfile::step(int goal) {
+    int32_t target = goal * ONE;
+    int32_t maxAcceleration = accelerationStep;
+    int32_t jerk = jerkStep;
+    int32_t error = target - velocity;
+    int32_t direction = error > 0 ? 1 : (error < 0 ? -1 : 0);
+
+    if(jerkStep == 0) {
+        //Trapezoid: as much acceleration as allowed, straight away
+        acceleration = error > maxAcceleration ? maxAcceleration : (error < -maxAcceleration ? -maxAcceleration : error);
+    } else {
+        //S-curve: the acceleration can only change by `jerk` each tick. Easing it back to 0 still changes the
+        //velocity by about a^2 / 2j + a / 2, so start easing off once the goal is that close.
+        int64_t a = acceleration;
+        int64_t easing = a * a / (2 * (int64_t)(jerk > 0 ? jerk : 1)) + (a >= 0 ? a : -a) / 2;
+        bool towardsGoal = a * direction > 0;
+        if(direction == 0 || (towardsGoal && (error >= 0 ? error : -error) <= easing)) {
+            //Ease the acceleration back towards 0
+            if(a > jerk) { a -= jerk; } else if(a < -jerk) { a += jerk; } else { a = 0; }
+        } else {
+            a += direction * jerk;
+            if(a > maxAcceleration) { a = maxAcceleration; }
+            if(a < -maxAcceleration) { a = -maxAcceleration; }
+        }
+        acceleration = (int32_t)a;
+    }
+
+    //Never go past the goal (this is also how the goal is always reached exactly)
+    int32_t next = velocity + acceleration;
+    if(direction == 0 || (int64_t)(target - next) * direction <= 0) {
+        velocity = target;
+        acceleration = 0;
+        progress = ONE;
+    } else {
+        velocity = next;
+        progress = (int32_t)(((int64_t)acceleration << 16) / error);
+    }
+    return getVelocity();
+}
+
+int MotionProfile::follow(int goal, int32_t progress) {
+    int32_t change = multiply(goal * ONE - velocity, progress);
+    //Kept as the acceleration, so that stepping on from here afterwards is still smooth
+    acceleration = change;
+    velocity += change;
+    this->progress = progress;
+    return getVelocity();
+}
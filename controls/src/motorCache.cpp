@@ -0,0 +1,125 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       motorCache.cpp                                                  */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Motor Command Cache Implementation                              */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "motorCache.h"
+
+uint32_t CachedMotor::totalSent = 0;
+uint32_t CachedMotor::totalSuppressed = 0;
+std::atomic<uint32_t> CachedMotor::halted(0);
+
+void CachedMotor::halt(uint32_t reason) { halted.fetch_or(reason, std::memory_order_acq_rel); }
+
+void CachedMotor::resume(uint32_t reason) { halted.fetch_and(~reason, std::memory_order_acq_rel); }
+
+CachedMotor::CachedMotor(motor &device) {
+    this->device = &device;
+}
+
+bool CachedMotor::stale() {
+    return timer::systemHighResolution() - lastSent >= (uint64_t)MOTOR_CACHE_REFRESH_TIME * 1000;
+}
+
+void CachedMotor::countSent() {
+    sent++;
+    totalSent++;
+    lastSent = timer::systemHighResolution();
+}
+
+void CachedMotor::countSuppressed() {
+    suppressed++;
+    totalSuppressed++;
+}
+
+void CachedMotor::setVelocity(double velocity, velocityUnits units) {
+    if(velocityKnown && velocitySetting == velocity && velocitySettingUnits == units) {
+        countSuppressed();
+        return;
+    }
+    device->setVelocity(velocity, units);
+    velocityKnown = true;
+    velocitySetting = velocity;
+    velocitySettingUnits = units;
+    countSent();
+}
+
+void CachedMotor::setMaxTorque(double percent) {
+    if(torqueKnown && torqueSetting == percent) {
+        countSuppressed();
+        return;
+    }
+    device->setMaxTorque(percent, percentUnits::pct);
+    torqueKnown = true;
+    torqueSetting = percent;
+    countSent();
+}
+
+void CachedMotor::spin(directionType dir) {
+    if(isHalted()) { return; }
+    if(lastCommand == Command::spin && direction == dir && spinVelocity == velocitySetting && !stale()) {
+        countSuppressed();
+        return;
+    }
+    device->spin(dir);
+    lastCommand = Command::spin;
+    direction = dir;
+    spinVelocity = velocitySetting;
+    countSent();
+}
+
+void CachedMotor::spin(directionType dir, double velocity, velocityUnits units) {
+    if(isHalted()) { return; }
+    if(lastCommand == Command::spin && direction == dir && velocityKnown
+            && spinVelocity == velocity && velocitySettingUnits == units && !stale()) {
+        countSuppressed();
+        return;
+    }
+    device->spin(dir, velocity, units);
+    lastCommand = Command::spin;
+    direction = dir;
+    velocityKnown = true;
+    velocitySetting = velocity;
+    velocitySettingUnits = units;
+    spinVelocity = velocity;
+    countSent();
+}
+
+void CachedMotor::spin(directionType dir, double voltage, voltageUnits units) {
+    if(isHalted()) { return; }
+    if(units == voltageUnits::mV) { voltage /= 1000.0; }
+    if(lastCommand == Command::voltage && direction == dir && spinVoltage == voltage && !stale()) {
+        countSuppressed();
+        return;
+    }
+    device->spin(dir, voltage, voltageUnits::volt);
+    lastCommand = Command::voltage;
+    direction = dir;
+    spinVoltage = voltage;
+    countSent();
+}
+
+void CachedMotor::stop(brakeType mode) {
+    if(lastCommand == Command::stop && stopping == mode && !stale()) {
+        countSuppressed();
+        return;
+    }
+    device->stop(mode);
+    lastCommand = Command::stop;
+    stopping = mode;
+    countSent();
+}
+
+void CachedMotor::invalidate() {
+    lastCommand = Command::none;
+    velocityKnown = false;
+    torqueKnown = false;
+}
@@ -0,0 +1,137 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       odometry.cpp                                                    */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Robot Position Tracking Implementation                          */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include <cmath>
+
+using namespace vex;
+
+#include "odometry.h"
+#include "ticker.h"
+
+/* Inches travelled per motor turn. */
+static const double INCHES_PER_TURN = WHEEL_DIAMETER * M_PI * DRIVE_GEAR_RATIO;
+
+static const double DEGREES_PER_RADIAN = 180.0 / M_PI;
+
+Odometry::Odometry(double trust) : pose(), trust(trust) {}
+
+void Odometry::update(double left, double right, double inertial, uint32_t time) {
+    if(!started) {
+        lastLeft = left;
+        lastRight = right;
+        pose.time = time;
+        started = true;
+    }
+    if(!std::isnan(inertial) && !inertialKnown) { //The sensor just finished calibrating
+        inertialOffset = inertial - pose.heading;
+        inertialKnown = true;
+    }
+
+    double leftDistance = (left - lastLeft) * INCHES_PER_TURN;
+    double rightDistance = (right - lastRight) * INCHES_PER_TURN;
+    lastLeft = left;
+    lastRight = right;
+
+    //Clockwise is positive, so the left side going further turns the robot right
+    double distance = (leftDistance + rightDistance) / 2;
+    double turn = (leftDistance - rightDistance) / TRACK_WIDTH * DEGREES_PER_RADIAN;
+    double oldHeading = pose.heading;
+    double heading = oldHeading + turn;
+    if(inertialKnown) {
+        heading += trust * ((inertial - inertialOffset) - heading);
+    }
+
+    //Move along the heading halfway through the update (close to the arc the robot actually drove)
+    double middle = (oldHeading + heading) / 2 / DEGREES_PER_RADIAN;
+    pose.x += distance * sin(middle);
+    pose.y += distance * cos(middle);
+    pose.heading = heading;
+
+    if(time > pose.time) {
+        double seconds = (time - pose.time) / 1000.0;
+        pose.velocity = distance / seconds;
+        pose.angularVelocity = (heading - oldHeading) / seconds;
+    }
+    pose.time = time;
+}
+
+void Odometry::reset(double x, double y, double heading, double inertial) {
+    pose.x = x;
+    pose.y = y;
+    pose.heading = heading;
+    pose.velocity = 0;
+    pose.angularVelocity = 0;
+    inertialKnown = !std::isnan(inertial);
+    inertialOffset = inertialKnown ? inertial - heading : 0;
+}
+
+void PoseSnapshot::publish(const Pose &pose) {
+    uint32_t start = sequence.load(std::memory_order_relaxed);
+    sequence.store(start + 1, std::memory_order_relaxed); //Odd: being written
+    std::atomic_thread_fence(std::memory_order_release);
+    this->pose = pose;
+    sequence.store(start + 2, std::memory_order_release);
+}
+
+Pose PoseSnapshot::read() {
+    Pose copy;
+    uint32_t start;
+    do {
+        start = sequence.load(std::memory_order_acquire);
+        copy = pose;
+        std::atomic_thread_fence(std::memory_order_acquire);
+    } while((start & 1) != 0 || sequence.load(std::memory_order_relaxed) != start);
+    return copy;
+}
+
+PoseSnapshot robotPose;
+
+uint32_t odometryUpdateTime = 0, odometryWorstUpdateTime = 0;
+
+static Odometry odometry(INERTIAL_TRUST);
+
+/* The inertial sensor's rotation, or NAN while it is calibrating (or not plugged in). */
+static double readInertial() {
+    if(!inertialSensor.installed() || inertialSensor.isCalibrating()) {
+        return NAN;
+    }
+    return inertialSensor.rotation(degrees);
+}
+
+void updateOdometry() {
+    uint64_t start = timer::systemHighResolution();
+    odometry.update(leftWheelTrainMotor.position(turns), rightWheelTrainMotor.position(turns), readInertial(), timer::system());
+    robotPose.publish(odometry.getPose());
+
+    odometryUpdateTime = (uint32_t)(timer::systemHighResolution() - start);
+    if(odometryUpdateTime > odometryWorstUpdateTime) { odometryWorstUpdateTime = odometryUpdateTime; }
+}
+
+void resetOdometry(double x, double y, double heading) {
+    odometry.reset(x, y, heading, readInertial());
+    robotPose.publish(odometry.getPose());
+}
+
+static Ticker odometryTicker(ODOMETRY_PERIOD, "odometry");
+
+/* The odometry task. High priority, because the pose is only accurate if the updates are on time. */
+static int odometryTask() {
+    odometryTicker.start();
+    while(1) {
+        updateOdometry();
+        odometryTicker.waitForNextTick();
+    }
+    return 0;
+}
+
+void startOdometry() {
+    inertialSensor.calibrate();
+    task odometryUpdater(odometryTask, task::taskPriorityHigh);
+}
@@ -0,0 +1,159 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       pathFollower.cpp                                                */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Spline Paths and Pure Pursuit Implementation                    */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include <cmath>
+
+using namespace vex;
+
+#include "pathFollower.h"
+
+/* How many pieces each stretch between two waypoints is cut into to measure it. */
+static const int SPLINE_STEPS = 200;
+
+/* How sharply the path bends at point i (1 / the radius of the circle through it and its neighbours). */
+static double curvatureAt(const PathPoint *points, int size, int i) {
+    if(i <= 0 || i >= size - 1) { return 0; }
+    const PathPoint &a = points[i - 1], &b = points[i], &c = points[i + 1];
+    double ab = hypot(b.x - a.x, b.y - a.y), bc = hypot(c.x - b.x, c.y - b.y), ca = hypot(a.x - c.x, a.y - c.y);
+    double twiceArea = fabs((b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x));
+    return ab * bc * ca == 0 ? 0 : 2 * twiceArea / (ab * bc * ca);
+}
+
+Path::Path(const Waypoint *waypoints, int count, int speed) {
+    //Measure the path first, so the points can be spread out enough to fit
+    double length = 0;
+    Waypoint last = routeWaypoint(waypoints, count, 0, MIRROR);
+    for(int segment = 0; segment < count - 1; segment++) {
+        for(int step = 1; step <= SPLINE_STEPS; step++) {
+            Waypoint point = splineAt(waypoints, count, segment, (double)step / SPLINE_STEPS, MIRROR);
+            length += hypot(point.x - last.x, point.y - last.y);
+            last = point;
+        }
+    }
+    double spacing = fmax(PATH_SPACING, length / (MAX_PATH_POINTS - 2));
+
+    //Then walk along it again, dropping a point every `spacing`
+    last = routeWaypoint(waypoints, count, 0, MIRROR);
+    double travelled = 0;
+    points[0] = PathPoint{last.x, last.y, 0, 0};
+    size = 1;
+    for(int segment = 0; segment < count - 1; segment++) {
+        for(int step = 1; step <= SPLINE_STEPS; step++) {
+            Waypoint point = splineAt(waypoints, count, segment, (double)step / SPLINE_STEPS, MIRROR);
+            travelled += hypot(point.x - last.x, point.y - last.y);
+            last = point;
+            if(travelled - points[size - 1].distance >= spacing && size < MAX_PATH_POINTS - 1) {
+                points[size++] = PathPoint{point.x, point.y, travelled, 0};
+            }
+        }
+    }
+    //The path always ends exactly on the last waypoint
+    if(travelled - points[size - 1].distance < spacing / 2 && size > 1) { size--; }
+    points[size++] = PathPoint{last.x, last.y, travelled, 0};
+
+    //Slow enough on curves that the outside wheels stay under the top speed...
+    for(int i = 0; i < size; i++) {
+        points[i].speed = speed / (1 + curvatureAt(points, size, i) * TRACK_WIDTH / 2);
+    }
+    //...and slow down in time for them (the end is left to approachSpeed())
+    double braking = AUTONOMOUS_LIMITS.maxAcceleration * MOVE_BRAKING * INCHES_PER_SECOND_PER_RPM;
+    for(int i = size - 2; i >= 0; i--) {
+        double next = points[i + 1].speed * INCHES_PER_SECOND_PER_RPM;
+        double reachable = sqrt(next * next + 2 * braking * (points[i + 1].distance - points[i].distance)) / INCHES_PER_SECOND_PER_RPM;
+        if(reachable < points[i].speed) { points[i].speed = reachable; }
+    }
+}
+
+double PurePursuit::step(const Pose &pose, int speed, double &left, double &right) {
+    int size = path.getSize();
+    double spacing = path[1].distance;
+
+    //The closest point only moves forward, and only needs looking for as far as the robot could have got
+    int searchEnd = closest + (int)(MAX_LOOKAHEAD / spacing) + 2;
+    if(searchEnd > size) { searchEnd = size; }
+    double best = hypot(path[closest].x - pose.x, path[closest].y - pose.y);
+    for(int i = closest + 1; i < searchEnd; i++) {
+        double distance = hypot(path[i].x - pose.x, path[i].y - pose.y);
+        if(distance < best) {
+            best = distance;
+            closest = i;
+        }
+    }
+
+    //How far along the path the robot is: where it is alongside the stretch after the closest point (past the end at the end)
+    int from = closest < size - 1 ? closest : size - 2;
+    const PathPoint &a = path[from], &b = path[from + 1];
+    double segmentX = b.x - a.x, segmentY = b.y - a.y;
+    double segmentLength = hypot(segmentX, segmentY);
+    double along = ((pose.x - a.x) * segmentX + (pose.y - a.y) * segmentY) / segmentLength;
+    if(along < 0) { along = 0; }
+    if(along > segmentLength && from + 1 < size - 1) { along = segmentLength; }
+    double remaining = path.getLength() - (a.distance + along);
+
+    //The lookahead point: where the path leaves a circle of the lookahead distance around the robot
+    double lookahead = fabs(pose.velocity) * LOOKAHEAD_TIME;
+    if(lookahead < MIN_LOOKAHEAD) { lookahead = MIN_LOOKAHEAD; }
+    if(lookahead > MAX_LOOKAHEAD) { lookahead = MAX_LOOKAHEAD; }
+    double targetX = path[size - 1].x, targetY = path[size - 1].y;
+    for(int i = closest; i < size - 1; i++) {
+        const PathPoint &start = path[i], &end = path[i + 1];
+        if(hypot(end.x - pose.x, end.y - pose.y) < lookahead) { continue; }
+        //Solve |start + t (end - start) - robot| = lookahead for the t that leaves the circle
+        double dx = end.x - start.x, dy = end.y - start.y;
+        double fx = start.x - pose.x, fy = start.y - pose.y;
+        double qa = dx * dx + dy * dy, qb = 2 * (fx * dx + fy * dy), qc = fx * fx + fy * fy - lookahead * lookahead;
+        double t = (-qb + sqrt(fmax(0, qb * qb - 4 * qa * qc))) / (2 * qa);
+        targetX = start.x + t * dx;
+        targetY = start.y + t * dy;
+        break;
+    }
+
+    //The circle from the robot through the lookahead point (positive curves right)
+    double headingRadians = pose.heading * M_PI / 180.0;
+    double dx = targetX - pose.x, dy = targetY - pose.y;
+    double sideways = dx * cos(headingRadians) - dy * sin(headingRadians);
+    double distanceSquared = dx * dx + dy * dy;
+    double curvature = distanceSquared < 1e-6 ? 0 : 2 * sideways / distanceSquared;
+
+    double velocity = approachSpeed(remaining, speed);
+    if(velocity > path[closest].speed) { velocity = path[closest].speed; }
+    if(velocity < 0) { curvature = 0; } //Just back up onto the end if it went past
+
+    left = velocity * (1 + curvature * TRACK_WIDTH / 2);
+    right = velocity * (1 - curvature * TRACK_WIDTH / 2);
+    //Keep the wheels in proportion if either would be too fast
+    double fastest = fmax(fabs(left), fabs(right));
+    if(fastest > speed) {
+        left *= speed / fastest;
+        right *= speed / fastest;
+    }
+    return remaining;
+}
+
+void FollowPath::startMove(const Pose &) {
+    pursuit.reset();
+}
+
+double FollowPath::drive(const Pose &pose) {
+    double left, right;
+    double remaining = pursuit.step(pose, speed, left, right);
+    if(fabs(remaining) <= exit.tolerance) {
+        left = 0;
+        right = 0;
+    }
+    setDriveGoals(left, right);
+    return remaining;
+}
+
+bool followPath(const Path &path, int speed, ExitConditions exit) {
+    FollowPath move(path, speed, exit);
+    runAction(move);
+    return move.succeeded();
+}
@@ -9,6 +9,12 @@
 
 #include "vex.h"
 #include "debugScreen.h"
+#include "telemetry.h"
+#include "odometry.h"
+#include "emergencyStop.h"
+#include "watchdog.h"
+#include "battery.h"
+#include "latency.h"
 
 using namespace vex;
 using signature = vision::signature;
@@ -18,35 +24,72 @@ using code = vision::code;
 brain vexBrain;
 controller mainCon;
 
-double percentOfMaxSpeed = .4;
+Wheel::Wheel(motor &wheelMotor) : profile(DRIVER_LIMITS, TICK_LENGTH), controller(WHEEL_GAINS), wheelMotor(wheelMotor) {}
 
-Wheel::Wheel(motor &wheelMotor) {
-    this->wheelMotor = &wheelMotor;
+void Wheel::updateVelocity() {
+    int last = velocity;
+    velocity = profile.step(goalVelocity);
+    changed = velocity != last;
+    brakeIfStopped();
 }
 
-void Wheel::calculateAcceleratingVelocity() {
-    if(abs(goalVelocity-velocity) < abs(acceleration)) { //If the acceleration is close, then just go there now
-        velocity = goalVelocity;
-    } else if (velocity != goalVelocity) { //Accelerate
-        this->acceleration = (int)((this->goalVelocity - this->initialVelocity) * (angular_accelerational_constant));
-        this->velocity = this->velocity + this->acceleration;
+void Wheel::followVelocity(int32_t progress) {
+    int last = velocity;
+    velocity = profile.follow(goalVelocity, progress);
+    changed = velocity != last;
+    brakeIfStopped();
+}
+
+void Wheel::brakeIfStopped() {
+    //Stopping should not wait for the wheel control task, which resets the controller when it next runs
+    if(velocity == 0 && goalVelocity == 0 && traction.canStop()) {
+        wheelMotor.stop(brake);
+    }
+}
+
+void Wheel::control() {
+    //While the emergency stop is held nothing would get to the motor anyway, and the integral must not wind up
+    if(CachedMotor::isHalted()) {
+        controller.reset();
+        traction.reset();
+        wheelMotor.stop(brake);
+        inputTime = 0; //Nothing was sent for it
+        return;
     }
 
-    if(getVelocity() == 0) {
-        wheelMotor->stop(coast);
+    //Still measured while braking, since braking can break the wheel loose too
+    double measured = wheelMotor.device->velocity(rpm);
+    uint64_t now = timer::systemHighResolution();
+    double setpoint = traction.update(velocity, profile.getAcceleration(), measured, now);
+    if(velocity == 0 && goalVelocity == 0 && traction.canStop()) {
+        controller.reset();
+        wheelMotor.stop(brake);
     } else {
-        spin(forward);
+        //The controller works in the volts the motor really gets, and the battery decides how many a command gives it
+        double scale = batteryScale();
+        controller.setMaxVoltage(MAX_MOTOR_VOLTAGE / scale);
+        double volts = controller.update(setpoint, traction.getAcceleration(), measured, now);
+        wheelMotor.spin(forward, volts * scale, voltageUnits::volt);
+    }
+
+    //The first command sent since the stick moved the velocity (brakeIfStopped() may already have sent the brake)
+    uint64_t sent = wheelMotor.getLastSentTime();
+    if(inputTime != 0 && sent >= inputTime) {
+        inputLatencyHistogram.record((uint32_t)(sent - inputTime));
+        inputTime = 0;
     }
 }
 
 void Wheel::spin(directionType dir) {
-    this->wheelMotor->setVelocity(this->velocity, rpm);
-    this->wheelMotor->spin(dir);
+    this->wheelMotor.spin(dir, this->velocity, rpm);
 }
 
 void Wheel::spin(int velocity, directionType dir) {
-    this->wheelMotor->setVelocity(velocity, rpm);
-    this->wheelMotor->spin(dir);
+    this->wheelMotor.spin(dir, velocity, rpm);
+}
+
+void Wheel::stop(brakeType mode) {
+    this->wheelMotor.stop(mode);
 }
 
 // VEXcode device constructors
@@ -57,25 +100,31 @@ motor intakeRightMotor = motor(PORT6, ratio36_1, false);
 motor liftTopMotor = motor(PORT5, ratio36_1, false);
 motor liftBottomMotor = motor(PORT7, ratio36_1, false);
 
+inertial inertialSensor = inertial(PORT20);
+optical mouthSensor = optical(PORT2);
+optical topSensor = optical(PORT3);
+
+CachedMotor intakeLeft = CachedMotor(intakeLeftMotor);
+CachedMotor intakeRight = CachedMotor(intakeRightMotor);
+CachedMotor liftTop = CachedMotor(liftTopMotor);
+CachedMotor liftBottom = CachedMotor(liftBottomMotor);
+
 // Wheels
 Wheel rightWheelTrain = *new Wheel(rightWheelTrainMotor);
 Wheel leftWheelTrain = *new Wheel(leftWheelTrainMotor);
 
 Wheel *wheelTrains[NUM_WHEEL_TRAINS] = {&rightWheelTrain, &leftWheelTrain};
 
-// Controls
-vex::controller::axis forwardAxis = mainCon.Axis3;
-vex::controller::axis turningAxis = mainCon.Axis1;
-
-vex::controller::button speedUp = mainCon.ButtonUp;
-vex::controller::button speedDown = mainCon.ButtonDown;
+CachedMotor *allMotors[NUM_MOTORS] = {&rightWheelTrain.wheelMotor, &leftWheelTrain.wheelMotor,
+    &intakeLeft, &intakeRight, &liftTop, &liftBottom};
 
+// Controls
 vex::controller::button functionUp = mainCon.ButtonL1;
 vex::controller::button functionDown = mainCon.ButtonL2;
 vex::controller::button functionIntake = mainCon.ButtonR1;
 vex::controller::button functionExpel = mainCon.ButtonR2;
 
-vex::controller::button stopMotors = mainCon.ButtonDown;
+vex::controller::button stopMotors = mainCon.ButtonB;
 
 // VEXcode generated functions
 
@@ -89,10 +138,15 @@ const int FUNCTION_MOTOR_SPEED = 200; //rpm
 void vexcodeInit( void ) {
     //Inititalize the default velocity for motors with unchanging velocities
 
-    intakeLeftMotor.setVelocity(FUNCTION_MOTOR_SPEED, velocityUnits::rpm);
-    intakeRightMotor.setVelocity(FUNCTION_MOTOR_SPEED, velocityUnits::rpm);
-    liftTopMotor.setVelocity(FUNCTION_MOTOR_SPEED, velocityUnits::rpm);
-    liftBottomMotor.setVelocity(FUNCTION_MOTOR_SPEED, velocityUnits::rpm);
-
-    debugMenuController(); //Put stuff on debug screen
+    intakeLeft.setVelocity(FUNCTION_MOTOR_SPEED, velocityUnits::rpm);
+    intakeRight.setVelocity(FUNCTION_MOTOR_SPEED, velocityUnits::rpm);
+    liftTop.setVelocity(FUNCTION_MOTOR_SPEED, velocityUnits::rpm);
+    liftBottom.setVelocity(FUNCTION_MOTOR_SPEED, velocityUnits::rpm);
+
+    startWheelControl(); //Keep the wheels at their velocities (in the background)
+    startOdometry(); //Keep track of where the robot is (in the background)
+    startTelemetry(); //Write each tick to the SD card (in the background)
+    startDebugScreen(); //Put stuff on debug screen (in the background)
+    startEmergencyStop(); //Watch the emergency stop button (in the background)
+    startWatchdog(); //Stop the robot if a control loop stalls (in the background)
 }
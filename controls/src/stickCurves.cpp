@@ -0,0 +1,150 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       stickCurves.cpp                                                 */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Stick Response Curve Lookup Tables                              */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "stickCurves.h"
+
+int driverProfile = smoothProfile;
+int speedMode = fastSpeed;
+
+/*
+ * Everything below is constexpr, which in C++11 means every function is a
+ * single return statement (loops are written as recursion).
+*/
+
+/* The largest stick value once divided by the curve's divisor. */
+constexpr int curveMax(StickCurve curve) {
+    return 127 / curve.divisor;
+}
+
+/* Step 2 of StickCurve: the distance from center after the deadband, stretched back to 0 to curveMax(). */
+constexpr int pastDeadband(StickCurve curve, int distance) {
+    return curve.deadband == 0 ? distance
+        : (distance - curve.deadband) * curveMax(curve) / (curveMax(curve) - curve.deadband);
+}
+
+/*
+ * Steps 3 and 4 of StickCurve for a distance from center (after the
+ * deadband):
+ *     distance * speed% * ((100 - expo%) + expo% * (distance / max)^2)
+ * with all the divisions done last (and in 64 bits) so nothing is rounded
+ * early. With no expo this is exactly distance * speed% / 100.
+*/
+constexpr int curvedVelocity(StickCurve curve, long long distance) {
+    return (int)(distance * curve.speedPercent
+        * ((100 - curve.expo) * (long long)curveMax(curve) * curveMax(curve) + curve.expo * distance * distance)
+        / (100LL * 100 * curveMax(curve) * curveMax(curve)));
+}
+
+constexpr int curveMagnitude(StickCurve curve, int distance) {
+    return distance <= curve.deadband ? 0 : curvedVelocity(curve, pastDeadband(curve, distance));
+}
+
+/* The velocity for a stick value. The curve is the same both ways, only the sign changes. */
+constexpr int curveVelocity(StickCurve curve, int value) {
+    return value < 0 ? -curveMagnitude(curve, -value / curve.divisor) : curveMagnitude(curve, value / curve.divisor);
+}
+
+/* A list of the numbers 0 to N - 1, to make one table entry for each. */
+template<int... I> struct IndexList {};
+template<int N, int... I> struct MakeIndexList : MakeIndexList<N - 1, N - 1, I...> {};
+template<int... I> struct MakeIndexList<0, I...> { typedef IndexList<I...> type; };
+
+template<int... I>
+constexpr StickTable makeTable(StickCurve curve, IndexList<I...>) {
+    return StickTable{{ (int16_t)curveVelocity(curve, I - 127)... }};
+}
+
+constexpr StickTable makeTable(StickCurve curve) {
+    return makeTable(curve, MakeIndexList<STICK_VALUES>::type());
+}
+
+/* The curves for each profile, with the speed filled in for each speed mode. */
+constexpr StickCurve forwardCurve(int profile, int speed) {
+    return profile == classicProfile ? StickCurve{1, 0, 0, SPEED_MODE_PERCENTS[speed]}
+        : profile == smoothProfile ? StickCurve{1, 5, 60, SPEED_MODE_PERCENTS[speed]}
+        : StickCurve{1, 5, 100, SPEED_MODE_PERCENTS[speed]};
+}
+
+constexpr StickCurve turningCurve(int profile, int speed) {
+    return profile == classicProfile ? StickCurve{2, 0, 0, SPEED_MODE_PERCENTS[speed]}
+        : profile == smoothProfile ? StickCurve{2, 2, 40, SPEED_MODE_PERCENTS[speed]}
+        : StickCurve{2, 2, 100, SPEED_MODE_PERCENTS[speed]};
+}
+
+#define TABLES(curve) { \
+    {makeTable(curve(classicProfile, fastSpeed)), makeTable(curve(classicProfile, slowSpeed))}, \
+    {makeTable(curve(smoothProfile, fastSpeed)), makeTable(curve(smoothProfile, slowSpeed))}, \
+    {makeTable(curve(precisionProfile, fastSpeed)), makeTable(curve(precisionProfile, slowSpeed))} \
+}
+
+static_assert(NUM_DRIVER_PROFILES == 3 && NUM_SPEED_MODES == 2, "TABLES needs a table for every profile and speed mode");
+
+constexpr StickTable forwardTables[NUM_DRIVER_PROFILES][NUM_SPEED_MODES] = TABLES(forwardCurve);
+constexpr StickTable turningTables[NUM_DRIVER_PROFILES][NUM_SPEED_MODES] = TABLES(turningCurve);
+
+/*--------------------------------- Table checks ----------------------------------*/
+
+/*
+ * These are checked by the compiler every build, instead of unit tests. Each
+ * check runs over every stick value from `value` up to 127.
+*/
+
+/* The classic tables give exactly what movement() used to work out with doubles. */
+constexpr bool classicMatches(int speed, int value) {
+    return value > 127 || (
+        forwardTables[classicProfile][speed][value] == (int)(value * (SPEED_MODE_PERCENTS[speed] / 100.0))
+        && turningTables[classicProfile][speed][value] == (int)((int)(value / 2.0) * (SPEED_MODE_PERCENTS[speed] / 100.0))
+        && classicMatches(speed, value + 1));
+}
+
+/* Pushing a stick further never makes the robot go slower. */
+constexpr bool neverDecreases(const StickTable &table, int value) {
+    return value >= 127 || (table[value] <= table[value + 1] && neverDecreases(table, value + 1));
+}
+
+/* Left is the same as right, and back is the same as forward. */
+constexpr bool symmetric(const StickTable &table, int value) {
+    return value > 127 || (table[-value] == -table[value] && symmetric(table, value + 1));
+}
+
+/* A curve is never faster than the classic line (that is where the finer control comes from). */
+constexpr bool belowClassic(const StickTable &table, const StickTable &classic, int value) {
+    return value > 127 || (table[value] <= classic[value] && belowClassic(table, classic, value + 1));
+}
+
+/* Everything that should hold for every table. */
+constexpr bool tableIsSound(const StickTable &table, const StickTable &classic, int deadband) {
+    return table[0] == 0 && table[deadband] == 0 && table[127] == classic[127]
+        && neverDecreases(table, -127) && symmetric(table, 0) && belowClassic(table, classic, 0);
+}
+
+static_assert(classicMatches(fastSpeed, -127) && classicMatches(slowSpeed, -127),
+    "The classic profile should drive exactly like before");
+
+#define CHECK_TABLES(profile, speed) \
+    static_assert(tableIsSound(forwardTables[profile][speed], forwardTables[classicProfile][speed], \
+        forwardCurve(profile, speed).deadband), "Bad forward table"); \
+    static_assert(tableIsSound(turningTables[profile][speed], turningTables[classicProfile][speed], \
+        turningCurve(profile, speed).deadband * turningCurve(profile, speed).divisor), "Bad turning table")
+
+CHECK_TABLES(smoothProfile, fastSpeed);
+CHECK_TABLES(smoothProfile, slowSpeed);
+CHECK_TABLES(precisionProfile, fastSpeed);
+CHECK_TABLES(precisionProfile, slowSpeed);
+
+//Spot checks, so a change to the curves is a deliberate one
+static_assert(forwardTables[classicProfile][fastSpeed][127] == 50, "Full stick is 50 rpm in fast mode");
+static_assert(forwardTables[classicProfile][slowSpeed][127] == 25, "Full stick is 25 rpm in slow mode");
+static_assert(forwardTables[smoothProfile][fastSpeed][64] < forwardTables[classicProfile][fastSpeed][64],
+    "Half stick should be slower with expo");
+static_assert(forwardTables[precisionProfile][fastSpeed][30] <= 1, "Small movements should barely move");
@@ -0,0 +1,217 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       telemetry.cpp                                                   */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Per Tick Telemetry Recorder Implementation                      */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "telemetry.h"
+
+#include <stddef.h>
+
+//One channel per field of TelemetryRecord
+#define CHANNEL(name, units, field, type, divisor) \
+    {name, units, (uint16_t)offsetof(TelemetryRecord, field), type, 0, divisor}
+
+const TelemetryChannel TELEMETRY_CHANNELS[] = {
+    CHANNEL("time", "us", time, telemetryUint32, 1),
+    CHANNEL("sequence", "", sequence, telemetryUint16, 1),
+    CHANNEL("batteryVoltage", "V", batteryVoltage, telemetryUint16, 1000),
+    CHANNEL("axis1", "", axes[Axis1], telemetryInt8, 1),
+    CHANNEL("axis2", "", axes[Axis2], telemetryInt8, 1),
+    CHANNEL("axis3", "", axes[Axis3], telemetryInt8, 1),
+    CHANNEL("axis4", "", axes[Axis4], telemetryInt8, 1),
+    CHANNEL("buttons", "", buttons, telemetryUint16, 1),
+    CHANNEL("wheel0.temperature", "C", temperatures[0], telemetryUint8, 1),
+    CHANNEL("wheel1.temperature", "C", temperatures[1], telemetryUint8, 1),
+    CHANNEL("wheel0.goalVelocity", "rpm", wheels[0].goalVelocity, telemetryInt8, 1),
+    CHANNEL("wheel0.slips", "", wheels[0].slips, telemetryUint8, 1),
+    CHANNEL("wheel0.velocity", "rpm", wheels[0].velocity, telemetryInt16, 1),
+    CHANNEL("wheel0.measuredVelocity", "rpm", wheels[0].measuredVelocity, telemetryInt16, 10),
+    CHANNEL("wheel0.current", "A", wheels[0].current, telemetryUint16, 1000),
+    CHANNEL("wheel1.goalVelocity", "rpm", wheels[1].goalVelocity, telemetryInt8, 1),
+    CHANNEL("wheel1.slips", "", wheels[1].slips, telemetryUint8, 1),
+    CHANNEL("wheel1.velocity", "rpm", wheels[1].velocity, telemetryInt16, 1),
+    CHANNEL("wheel1.measuredVelocity", "rpm", wheels[1].measuredVelocity, telemetryInt16, 10),
+    CHANNEL("wheel1.current", "A", wheels[1].current, telemetryUint16, 1000),
+};
+const int NUM_TELEMETRY_CHANNELS = sizeof(TELEMETRY_CHANNELS) / sizeof(TELEMETRY_CHANNELS[0]);
+
+static_assert(NUM_WHEEL_TRAINS == 2, "TELEMETRY_CHANNELS needs a set of channels for every wheel train");
+static_assert(sizeof(TelemetryFileHeader) + sizeof(TELEMETRY_CHANNELS) <= TELEMETRY_HEADER_SIZE,
+    "The channels do not fit in TELEMETRY_HEADER_SIZE");
+
+TelemetryBuffer telemetryBuffer;
+char telemetryFile[16] = "";
+
+/* Only written by the telemetry task (or flushTelemetry()). */
+static std::atomic<uint32_t> written(0);
+static std::atomic<uint32_t> droppedWrite(0);
+
+bool TelemetryBuffer::push(const TelemetryRecord &record) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if(h - tail.load(std::memory_order_acquire) >= CAPACITY) {
+        dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        return false;
+    }
+    records[h & (CAPACITY - 1)] = record;
+    head.store(h + 1, std::memory_order_release); //The record is written before the consumer can see it
+    return true;
+}
+
+uint32_t TelemetryBuffer::peek(const TelemetryRecord *&first) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t waiting = head.load(std::memory_order_acquire) - t;
+    uint32_t slot = t & (CAPACITY - 1);
+    first = &records[slot];
+    return waiting < CAPACITY - slot ? waiting : CAPACITY - slot;
+}
+
+void TelemetryBuffer::release(uint32_t count) {
+    tail.store(tail.load(std::memory_order_relaxed) + count, std::memory_order_release);
+}
+
+TelemetryStats getTelemetryStats() {
+    TelemetryStats stats;
+    stats.recorded = telemetryBuffer.pushed();
+    stats.written = written.load(std::memory_order_relaxed);
+    stats.droppedFull = telemetryBuffer.getDropped();
+    stats.droppedWrite = droppedWrite.load(std::memory_order_relaxed);
+    return stats;
+}
+
+/* Clamps a value into the range of an int8_t. */
+static int8_t toInt8(int value) {
+    if(value > 127) { return 127; }
+    if(value < -128) { return -128; }
+    return (int8_t)value;
+}
+
+/* Clamps a value into the range of an int16_t. */
+static int16_t toInt16(double value) {
+    if(value > 32767) { return 32767; }
+    if(value < -32768) { return -32768; }
+    return (int16_t)value;
+}
+
+void recordTelemetry(const InputFrame &input, bool autonomous) {
+    if(telemetryFile[0] == '\0') { return; } //No SD card
+
+    //Battery voltage and temperatures change slowly, so they are only read every few ticks
+    static uint32_t ticks = 0;
+    static uint16_t batteryVoltage = 0;
+    static uint8_t temperatures[NUM_WHEEL_TRAINS] = {};
+    bool readSlow = ticks++ % TELEMETRY_SLOW_TICKS == 0;
+
+    TelemetryRecord record;
+    record.time = (uint32_t)input.time;
+    record.sequence = (uint16_t)telemetryBuffer.pushed();
+    for(int i=0; i<NUM_AXES; i++) {
+        record.axes[i] = (int8_t)input.axis((InputAxis)i);
+    }
+    record.buttons = (uint16_t)input.buttons | (autonomous ? TELEMETRY_AUTONOMOUS : 0);
+    if(readSlow) { batteryVoltage = (uint16_t)vexBrain.Battery.voltage(voltageUnits::mV); }
+    record.batteryVoltage = batteryVoltage;
+
+    for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
+        Wheel *wheel = wheelTrains[i];
+        motor *device = wheel->wheelMotor.device;
+        TelemetryWheel &out = record.wheels[i];
+        out.goalVelocity = toInt8(wheel->getGoalVelocity());
+        out.slips = (uint8_t)wheel->getTraction().getSlips();
+        out.velocity = toInt16(wheel->getVelocity());
+        out.measuredVelocity = toInt16(device->velocity(rpm) * 10);
+        out.current = (uint16_t)toInt16(device->current(amp) * 1000);
+        if(readSlow) { temperatures[i] = (uint8_t)device->temperature(celsius); }
+        record.temperatures[i] = temperatures[i];
+    }
+
+    telemetryBuffer.push(record);
+}
+
+/* Writes up to `maxRecords` of the waiting records to the SD card, in one piece. */
+static uint32_t writeRecords(uint32_t maxRecords) {
+    const TelemetryRecord *first;
+    uint32_t count = telemetryBuffer.peek(first);
+    if(count > maxRecords) { count = maxRecords; }
+    if(count == 0) { return 0; }
+
+    //Written straight out of the buffer, the control loop never touches these slots until they are released
+    int32_t length = (int32_t)(count * sizeof(TelemetryRecord));
+    int32_t result = vexBrain.SDcard.appendfile(telemetryFile, (uint8_t *)first, length);
+    if(result == length) {
+        written.store(written.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+    } else {
+        droppedWrite.store(droppedWrite.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+    }
+    telemetryBuffer.release(count);
+    return count;
+}
+
+void flushTelemetry() {
+    if(telemetryFile[0] == '\0') { return; }
+    while(writeRecords(TELEMETRY_BLOCK_RECORDS) > 0) {}
+}
+
+/* The telemetry task. Lowest priority so that it only writes when nothing else needs to run. */
+static int telemetryTask() {
+    bool wasEnabled = competition::isEnabled();
+    while(1) {
+        //Write everything left at the end of a match
+        bool enabled = competition::isEnabled();
+        if(wasEnabled && !enabled) { flushTelemetry(); }
+        wasEnabled = enabled;
+
+        if(telemetryBuffer.size() >= TELEMETRY_BLOCK_RECORDS) {
+            //Writing is slow, so start right after a tick was recorded, when the control loop has the longest to wait anyway
+            uint32_t pushed = telemetryBuffer.pushed();
+            while(telemetryBuffer.pushed() == pushed && competition::isEnabled()) {
+                this_thread::sleep_for(1);
+            }
+            writeRecords(TELEMETRY_BLOCK_RECORDS);
+            continue;
+        }
+
+        this_thread::sleep_for(TELEMETRY_FLUSH_TIME);
+    }
+    return 0;
+}
+
+void startTelemetry() {
+    if(!vexBrain.SDcard.isInserted()) { return; }
+
+    //Never overwrite the log of an earlier run
+    char name[sizeof(telemetryFile)];
+    for(int i=0; i<TELEMETRY_MAX_FILES; i++) {
+        snprintf(name, sizeof(name), TELEMETRY_FILE_FORMAT, i);
+        if(!vexBrain.SDcard.exists(name)) {
+            strcpy(telemetryFile, name);
+            break;
+        }
+    }
+    if(telemetryFile[0] == '\0') { return; } //SD card is full of logs
+
+    //The header says what is in each record, so logs can be read after TelemetryRecord changes
+    static uint8_t header[TELEMETRY_HEADER_SIZE];
+    TelemetryFileHeader fileHeader;
+    memcpy(fileHeader.magic, TELEMETRY_MAGIC, sizeof(fileHeader.magic));
+    fileHeader.version = TELEMETRY_FORMAT_VERSION;
+    fileHeader.headerSize = TELEMETRY_HEADER_SIZE;
+    fileHeader.recordSize = sizeof(TelemetryRecord);
+    fileHeader.channelCount = NUM_TELEMETRY_CHANNELS;
+    fileHeader.tickLength = TICK_LENGTH * 1000;
+    memcpy(header, &fileHeader, sizeof(fileHeader));
+    memcpy(header + sizeof(fileHeader), TELEMETRY_CHANNELS, sizeof(TELEMETRY_CHANNELS));
+    if(vexBrain.SDcard.savefile(telemetryFile, header, sizeof(header)) != (int32_t)sizeof(header)) {
+        telemetryFile[0] = '\0';
+        return;
+    }
+
+    task telemetryWriter(telemetryTask, 1); //1 is the lowest priority
+}
@@ -0,0 +1,114 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       thermal.cpp                                                     */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Motor Temperature Tracking And Derating Implementation          */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "thermal.h"
+
+ThermalTracker motorThermals[NUM_MOTORS];
+
+void ThermalTracker::add(double celsius) {
+    if(!started) {
+        started = true;
+        reading = temperature = celsius;
+        return;
+    }
+
+    sinceCrossing++;
+    double seconds = sinceCrossing * (THERMAL_SAMPLE_TIME / 1000.0);
+    if(celsius != reading) {
+        //Readings are rounded down, so the higher of the two is the step the motor crossed
+        double crossing = fmax(celsius, reading);
+        step = fabs(celsius - reading);
+        reading = celsius;
+        //Going back and forth over the same step (heating while pushing, cooling in between) only counts the first time
+        if(!crossed || crossing != lastCrossing) {
+            if(crossed) { slope = (crossing - lastCrossing) / seconds; }
+            crossed = true;
+            lastCrossing = crossing;
+            sinceCrossing = 0;
+            seconds = 0;
+        }
+    }
+    if(crossed && seconds > 0) {
+        //No new step yet, so it can not be going any faster than would have reached the next one by now
+        double most = step / seconds;
+        if(slope > most) { slope = most; }
+        if(slope < -most) { slope = -most; }
+    }
+
+    if(!crossed) {
+        temperature = reading;
+        return;
+    }
+    temperature = lastCrossing + slope * seconds;
+    if(temperature < reading) { temperature = reading; }
+    if(temperature > reading + step) { temperature = reading + step; }
+}
+
+double ThermalTracker::secondsToThrottle() const {
+    if(temperature >= THROTTLE_TEMPERATURE) { return 0; }
+    if(slope <= 0) { return -1; }
+    return (THROTTLE_TEMPERATURE - temperature) / slope;
+}
+
+double ThermalTracker::getPower() const {
+    double ahead = temperature + (slope > 0 ? slope * THERMAL_LOOKAHEAD : 0);
+    double hot = (ahead - DERATE_TEMPERATURE) / (THROTTLE_TEMPERATURE - DERATE_TEMPERATURE);
+    if(hot < 0) { hot = 0; }
+    if(hot > 1) { hot = 1; }
+    return 1 - (1 - MIN_THERMAL_POWER) * hot;
+}
+
+/* Only written by the control loop. */
+static double drivePowerNow = 1;
+
+double drivePower() { return drivePowerNow; }
+
+/* @returns double   The power of a motor's tracker (found through allMotors). */
+static double powerOf(CachedMotor &motor) {
+    for(int i=0; i<NUM_MOTORS; i++) {
+        if(allMotors[i] == &motor) { return motorThermals[i].getPower(); }
+    }
+    return 1;
+}
+
+void updateThermal() {
+    static bool sampled = false;
+    static uint32_t lastSample = 0;
+    uint32_t now = timer::system();
+    if(sampled && now - lastSample < (uint32_t)THERMAL_SAMPLE_TIME) { return; }
+    sampled = true;
+    lastSample = now;
+
+    for(int i=0; i<NUM_MOTORS; i++) {
+        motorThermals[i].add(allMotors[i]->device->temperature(celsius));
+    }
+
+    //Both sides of the drive get the same power, or the robot would curve towards the hotter side
+    double drive = 1;
+    for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
+        double power = powerOf(wheelTrains[i]->wheelMotor);
+        if(power < drive) { drive = power; }
+    }
+    drivePowerNow = drive;
+    for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
+        wheelTrains[i]->wheelMotor.setMaxTorque(drive * 100);
+    }
+
+    //The intake and lift motors work in pairs, so each pair is derated together (only sent if it changed)
+    double intakePower = fmin(powerOf(intakeLeft), powerOf(intakeRight));
+    intakeLeft.setMaxTorque(intakePower * 100);
+    intakeRight.setMaxTorque(intakePower * 100);
+    double liftPower = fmin(powerOf(liftTop), powerOf(liftBottom));
+    liftTop.setMaxTorque(liftPower * 100);
+    liftBottom.setMaxTorque(liftPower * 100);
+}
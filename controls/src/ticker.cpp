@@ -0,0 +1,62 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       ticker.cpp                                                      */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Fixed Rate Tick Scheduler Implementation                        */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "ticker.h"
+#include "watchdog.h"
+
+Ticker controlTicker(TICK_LENGTH, "control");
+
+Ticker::Ticker(int periodMs, const char *name) : name(name), running(false), checkedIn(0) {
+    this->period = (uint32_t)periodMs * 1000;
+    if(name != nullptr) { watchTicker(this); }
+}
+
+void Ticker::start() {
+    lastTickStart = timer::systemHighResolution();
+    checkedIn.store((uint32_t)lastTickStart, std::memory_order_release);
+    running.store(true, std::memory_order_release);
+    //Deadlines are kept on whole milliseconds, since that is what the brain sleeps in
+    deadline = (lastTickStart + period + 999) / 1000 * 1000;
+    ticks = 0;
+    overruns = 0;
+    lastPeriod = 0;
+    lastWork = 0;
+    lastJitter = 0;
+    worstJitter = 0;
+}
+
+void Ticker::waitForNextTick() {
+    uint64_t now = timer::systemHighResolution();
+    lastWork = (uint32_t)(now - lastTickStart);
+
+    //Took too long, so skip the deadlines we missed (keeping the same rhythm)
+    while(deadline < now) {
+        deadline += period;
+        overruns++;
+    }
+
+    this_thread::sleep_until(deadline / 1000);
+
+    now = timer::systemHighResolution();
+    lastJitter = (uint32_t)(now > deadline ? now - deadline : 0);
+    if(lastJitter > worstJitter) { worstJitter = lastJitter; }
+    lastPeriod = (uint32_t)(now - lastTickStart);
+    lastTickStart = now;
+    checkedIn.store((uint32_t)now, std::memory_order_release);
+    deadline += period;
+    ticks++;
+}
+
+void Ticker::stop() {
+    running.store(false, std::memory_order_release);
+}
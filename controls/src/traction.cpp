@@ -0,0 +1,165 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       traction.cpp                                                    */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Wheel Slip Detection And Traction Control Implementation        */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "traction.h"
+#include "driveMoves.h"
+
+bool tractionControl = true;
+
+/* The wheels' rpm/s for the robot speeding up at 1 g (386.09 inches/s^2). */
+static const double RPM_PER_SECOND_PER_G = 386.09 / INCHES_PER_SECOND_PER_RPM;
+
+static double sign(double value) {
+    return value > 0 ? 1 : (value < 0 ? -1 : 0);
+}
+
+double TractionControl::update(double velocity, double profileAcceleration, double measured, uint64_t time) {
+    //A long pause (like a breakpoint) says nothing about now
+    if(lastTime != 0 && time - lastTime > 100000) { reset(); }
+    //The first update after a reset has nothing to compare with, so assume a normal period
+    dt = lastTime == 0 ? WHEEL_CONTROL_PERIOD / 1000.0 : (time - lastTime) / 1000000.0;
+    acceleration = lastTime == 0 ? 0 : (measured - lastMeasured) / dt;
+    lastMeasured = measured;
+    lastTime = time;
+    if(!started) {
+        setpoint = measured;
+        floorVelocity = measured;
+        started = true;
+    }
+
+    if(slipping) {
+        //Back to the floor's speed, so the wheel grips again as soon as it can (the feedforward is for the robot's weight, which it is not carrying)
+        setpoint = floorVelocity;
+        setpointAcceleration = 0;
+    } else {
+        //Never asks for more than the floor gives, even when the profile jumps in one tick
+        double step = limit * dt;
+        double change = velocity - setpoint;
+        if(fabs(change) <= step) {
+            setpoint = velocity;
+            setpointAcceleration = fabs(profileAcceleration) > limit ? sign(profileAcceleration) * limit : profileAcceleration;
+            limiting = false;
+        } else {
+            //As fast as the profile asked for, over its tick (its own acceleration is 0 once it reached the goal)
+            double asked = fmax(profileAcceleration * sign(change), fabs(change) * 1000.0 / TICK_LENGTH);
+            double rate = fmin(asked, limit);
+            setpointAcceleration = sign(change) * rate;
+            setpoint += sign(change) * step;
+            limiting = true;
+        }
+    }
+
+    if(!tractionControl) {
+        setpointAcceleration = profileAcceleration;
+        given = velocity;
+    } else {
+        given = setpoint;
+    }
+    return given;
+}
+
+bool TractionControl::canStop() const {
+    return !tractionControl || (!slipping && fabs(given) <= limit * WHEEL_CONTROL_PERIOD / 1000.0);
+}
+
+void TractionControl::check(bool robotKnown, double floor) {
+    if(lastTime == 0) { return; }
+    if(!robotKnown) {
+        //Without the sensor all there is to go on is what the floor could do at most
+        floor = fabs(acceleration) > TRACTION_LIMIT ? sign(acceleration) * TRACTION_LIMIT : acceleration;
+    }
+    double excess = acceleration - floor;
+    bool looksSlipping = fabs(excess) > SLIP_ACCELERATION_MARGIN;
+
+    //Where the floor under the wheel went since the wheel last looked fine
+    floorVelocity += floor * dt;
+
+    if(slipping) {
+        //Caught again once the floor has come back to the wheel (or gone past it, between updates) and it stops sliding
+        double ahead = (lastMeasured - floorVelocity) * direction;
+        if(ahead > SLIP_VELOCITY_MARGIN || (ahead > 0 && looksSlipping)) { return; }
+        slipping = false;
+        suspect = 0;
+        setpoint = lastMeasured;
+    }
+
+    if(!looksSlipping) {
+        suspect = 0;
+        gripped = true;
+        floorVelocity = lastMeasured;
+        //Only creeps back up while the floor is showing it gives what the wheel is held to
+        if(limiting) { limit += (TRACTION_LIMIT - limit) * TRACTION_REGAIN * dt; }
+        return;
+    }
+
+    //The floor's speed is only known once the wheel has gripped since the reset (it may be braked while the robot slides on)
+    if(++suspect >= SLIP_CONFIRM_UPDATES && gripped) {
+        slipping = true;
+        slips++;
+        //Which way the wheel is off the floor (it may already be coming back, so not always the way it sped up)
+        direction = lastMeasured != floorVelocity ? sign(lastMeasured - floorVelocity) : sign(excess);
+        //Only as fast as the floor was just seen to give, while sliding
+        double found = robotKnown ? fabs(floor) * TRACTION_RECOVERY : limit / 2;
+        limit = fmax(fmin(found, limit), MIN_TRACTION_LIMIT);
+    }
+}
+
+void TractionControl::reset() {
+    lastMeasured = 0;
+    acceleration = 0;
+    lastTime = 0;
+    suspect = 0;
+    started = false;
+    gripped = false;
+    slipping = false;
+    setpointAcceleration = 0;
+    given = 0;
+}
+
+void TractionControl::jump(double velocity) {
+    //Whatever the wheel does next is a new start, asked for on purpose
+    started = true;
+    slipping = false;
+    suspect = 0;
+    limiting = false;
+    setpoint = velocity;
+    setpointAcceleration = 0;
+    given = velocity;
+}
+
+void checkTraction() {
+    static double lastTurnRate = 0;
+    static uint64_t lastTime = 0;
+    bool known = inertialSensor.installed() && !inertialSensor.isCalibrating();
+    double forward = 0, turning = 0;
+    uint64_t time = timer::systemHighResolution();
+    if(known) {
+        forward = inertialSensor.acceleration(INERTIAL_FORWARD_AXIS) * INERTIAL_FORWARD_SIGN * RPM_PER_SECOND_PER_G;
+        double turnRate = inertialSensor.gyroRate(INERTIAL_TURN_AXIS, velocityUnits::dps) * INERTIAL_TURN_SIGN;
+        double dt = (time - lastTime) / 1000000.0;
+        //How fast each side speeds up against the middle, from how fast the turning changes
+        if(lastTime != 0 && dt > 0 && dt <= 0.1) {
+            turning = (turnRate - lastTurnRate) / dt * M_PI / 180.0 * TRACK_WIDTH / 2 / INCHES_PER_SECOND_PER_RPM;
+        }
+        lastTurnRate = turnRate;
+        lastTime = time;
+    } else {
+        lastTime = 0;
+    }
+
+    for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
+        //The left side speeds up when turning faster clockwise
+        double side = wheelTrains[i] == &leftWheelTrain ? 1 : -1;
+        wheelTrains[i]->getTraction().check(known, forward + side * turning);
+    }
+}
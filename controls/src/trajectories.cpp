@@ -0,0 +1,75 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       trajectories.cpp                                                */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Precomputed Autonomous Trajectories                             */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+#include <cmath>
+
+using namespace vex;
+
+#include "trajectories.h"
+#include "trajectoryTables.h"
+
+static_assert(trajectoryBytesPerSecond() <= TRAJECTORY_BYTES_PER_SECOND_BUDGET,
+    "A second of trajectory takes too much flash, see TrajectorySample");
+
+/*
+ * The table for this side. Only the one picked is used, so the other is left
+ * out of the program.
+*/
+template<int N>
+constexpr TrajectoryTable sideTrajectory(const TrajectorySample (&right)[N], const TrajectorySample (&left)[N]) {
+    return TrajectoryTable{SIDE < 0 ? left : right, N};
+}
+
+//If one of these fails, a route or the robot changed: run `make -f sim.mk` to make trajectoryTables.h again
+static_assert(routeFingerprint(HOME_ROW) == HOME_ROW_FINGERPRINT, "trajectoryTables.h is out of date for HOME_ROW");
+
+const TrajectoryTable homeRowTrajectory = sideTrajectory(HOME_ROW_RIGHT, HOME_ROW_LEFT);
+
+void FollowTrajectory::startMove(const Pose &) {
+    start = timer::system();
+}
+
+double FollowTrajectory::drive(const Pose &pose) {
+    int index = (int)((timer::system() - start) / TRAJECTORY_PERIOD);
+    if(index >= trajectory.size) { index = trajectory.size - 1; }
+    const TrajectorySample &sample = trajectory.samples[index];
+    //The wheels take a moment to get to a velocity, so ask for it that much early
+    int lead = index + TRAJECTORY_LEAD / TRAJECTORY_PERIOD;
+    const TrajectorySample &upcoming = trajectory.samples[lead < trajectory.size ? lead : trajectory.size - 1];
+
+    //Where the robot should be, from the robot: how far ahead and how far to the right
+    double dx = (double)sample.x / TRAJECTORY_POSITION_SCALE - pose.x;
+    double dy = (double)sample.y / TRAJECTORY_POSITION_SCALE - pose.y;
+    double headingRadians = pose.heading * M_PI / 180.0;
+    double ahead = dx * sin(headingRadians) + dy * cos(headingRadians);
+    double sideways = dx * cos(headingRadians) - dy * sin(headingRadians);
+    double headingError = (double)sample.heading / TRAJECTORY_HEADING_SCALE - pose.heading;
+
+    //The trajectory's own velocities, plus a bit to catch up with it
+    double catchUp = approachSpeed(ahead, MOVE_SPEED);
+    double steer = HEADING_CORRECTION * headingError + TRAJECTORY_SIDEWAYS_CORRECTION * sideways;
+    double left = (double)upcoming.left / TRAJECTORY_VELOCITY_SCALE + catchUp + steer;
+    double right = (double)upcoming.right / TRAJECTORY_VELOCITY_SCALE + catchUp - steer;
+
+    //Only finished once the trajectory has run out
+    double remaining = index < trajectory.size - 1 ? HUGE_VAL : ahead;
+    if(fabs(remaining) <= exit.tolerance) {
+        left = 0;
+        right = 0;
+    }
+    setDriveGoals(left, right);
+    return remaining;
+}
+
+bool followTrajectory(const TrajectoryTable &trajectory, ExitConditions exit) {
+    FollowTrajectory move(trajectory, exit);
+    runAction(move);
+    return move.succeeded();
+}
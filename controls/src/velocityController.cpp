@@ -0,0 +1,73 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       velocityController.cpp                                          */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Closed-Loop Wheel Velocity Controller Implementation            */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "velocityController.h"
+#include "ticker.h"
+#include "battery.h"
+#include "traction.h"
+
+double VelocityController::update(double setpoint, double acceleration, double measured, uint64_t time) {
+    //The first update after a reset has nothing to compare with, so assume a normal period
+    double dt = lastTime == 0 ? WHEEL_CONTROL_PERIOD / 1000.0 : (time - lastTime) / 1000000.0;
+    if(dt > 0.1) { dt = 0.1; } //Don't let a long pause (like a breakpoint) dump into the integral
+    double derivative = lastTime == 0 || dt <= 0 ? 0 : (measured - lastMeasured) / dt;
+    lastTime = time;
+    lastMeasured = measured;
+
+    double error = setpoint - measured;
+    double feedforward = gains.kV * setpoint + gains.kA * acceleration + (setpoint > 0 ? gains.kS : (setpoint < 0 ? -gains.kS : 0));
+    double rest = feedforward + gains.kP * error - gains.kD * derivative;
+
+    double newIntegral = integral + gains.kI * error * dt;
+    if(newIntegral > gains.maxIntegral) { newIntegral = gains.maxIntegral; }
+    if(newIntegral < -gains.maxIntegral) { newIntegral = -gains.maxIntegral; }
+
+    //Only let the integral grow if that does not push the output further past the limit
+    double output = rest + newIntegral;
+    bool saturated = (output > maxVoltage && newIntegral > integral)
+        || (output < -maxVoltage && newIntegral < integral);
+    if(!saturated) {
+        integral = newIntegral;
+    }
+    output = rest + integral;
+
+    if(output > maxVoltage) { output = maxVoltage; }
+    if(output < -maxVoltage) { output = -maxVoltage; }
+    return output;
+}
+
+void VelocityController::reset() {
+    integral = 0;
+    lastMeasured = 0;
+    lastTime = 0;
+}
+
+static Ticker wheelControlTicker(WHEEL_CONTROL_PERIOD, "wheels");
+
+/* The wheel control task. High priority, because it has to run on time and only takes a few microseconds. */
+static int wheelControlTask() {
+    wheelControlTicker.start();
+    while(1) {
+        updateBattery(); //Every voltage below is scaled with a fresh reading
+        for(int i=0; i<NUM_WHEEL_TRAINS; i++) {
+            wheelTrains[i]->control();
+        }
+        checkTraction();
+        wheelControlTicker.waitForNextTick();
+    }
+    return 0;
+}
+
+void startWheelControl() {
+    task wheelControl(wheelControlTask, task::taskPriorityHigh);
+}
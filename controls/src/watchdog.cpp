@@ -0,0 +1,102 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       watchdog.cpp                                                    */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Control Loop Stall Watchdog Implementation                      */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#include "vex.h"
+
+using namespace vex;
+
+#include "watchdog.h"
+#include "functionality.h"
+#include "latency.h"
+#include "ticker.h"
+
+/*
+ * The watched loops. Tickers are made before main() runs, so this is only
+ * ever filled in then (constant initialized, so it is ready before any
+ * Ticker's constructor, whatever order they run in).
+*/
+static Ticker *watched[MAX_WATCHED_LOOPS];
+static int numWatched = 0;
+
+/* Only written by the watchdog task. */
+static bool stalled[MAX_WATCHED_LOOPS];
+static uint32_t stallStarts[MAX_WATCHED_LOOPS]; //When the stalled loop last ticked (low 32 bits of µs)
+static WatchdogStats stats;
+
+void watchTicker(Ticker *ticker) {
+    if(numWatched < MAX_WATCHED_LOOPS) { watched[numWatched++] = ticker; }
+}
+
+WatchdogStats getWatchdogStats() { return stats; }
+
+/* Records a stall that just ended. */
+static void recordStall(const char *name, uint32_t duration) {
+    stats.last.name = name;
+    stats.last.duration = duration;
+    stats.last.time = timer::system();
+    if(duration >= stats.longest.duration) { stats.longest = stats.last; }
+}
+
+/* When the robot was last enabled (low 32 bits of µs). */
+static uint32_t enabledSince = 0;
+
+void checkWatchedLoops() {
+    uint64_t start = timer::systemHighResolution();
+    uint32_t now = (uint32_t)start;
+
+    //Loops are not expected to tick while disabled, and get a fresh period once enabled again
+    if(!competition::isEnabled()) { enabledSince = now; }
+
+    const char *stalledNow = nullptr;
+    for(int i=0; i<numWatched; i++) {
+        Ticker *ticker = watched[i];
+        uint32_t checkIn = ticker->getCheckIn();
+        uint32_t since = now - checkIn;
+        uint32_t sinceEnabled = now - enabledSince;
+        uint32_t late = since < sinceEnabled ? since : sinceEnabled;
+        uint32_t limit = ticker->getPeriod() + WATCHDOG_MARGIN * 1000;
+
+        if(!ticker->isRunning() || late <= limit) {
+            if(stalled[i]) {
+                //The loop ticked again (or finished), so this is how long it went without ticking
+                stalled[i] = false;
+                recordStall(ticker->getName(), (ticker->isRunning() ? checkIn : now) - stallStarts[i]);
+            }
+        } else if(!stalled[i]) {
+            stalled[i] = true;
+            stallStarts[i] = now - since;
+            stats.stalls++;
+            emergencyStop(watchdogHalt);
+            stallDetectionHistogram.record(late - limit);
+        }
+        if(stalled[i]) { stalledNow = ticker->getName(); }
+    }
+    stats.stalled = stalledNow;
+    if(stalledNow == nullptr) { resumeMotors(watchdogHalt); } //Does nothing unless the watchdog halted them
+
+    watchdogCheckHistogram.record((uint32_t)(timer::systemHighResolution() - start));
+}
+
+/* Not watched itself, as there would be nothing left to catch it. */
+static Ticker watchdogTicker(WATCHDOG_PERIOD);
+
+/* The watchdog task. Highest priority, so that a stalled loop with a lower priority can not hold it up too. */
+static int watchdogTask() {
+    enabledSince = (uint32_t)timer::systemHighResolution();
+    watchdogTicker.start();
+    while(1) {
+        checkWatchedLoops();
+        watchdogTicker.waitForNextTick();
+    }
+    return 0;
+}
+
+void startWatchdog() {
+    task watchdog(watchdogTask, task::taskPriorityHigh);
+}
@@ -0,0 +1,141 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       telemetryLog.h                                                  */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Telemetry Log Reader For Host Tools                             */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+#ifndef TELEMETRY_LOG_HEADER_GUARD
+#define TELEMETRY_LOG_HEADER_GUARD
+
+/**
+ * Reads telemetry logs (see telemetryFormat.h) on a computer, for the tools
+ * and the simulator. Logs are memory mapped, and values are looked up by
+ * channel name, so logs made with older or newer records can be read.
+ *
+ *      TelemetryLog log;
+ *      if(openTelemetryLog("telem000.bin", log)) {
+ *          TelemetryLogChannel time = log.channel("time");
+ *          for(size_t i = 0; i < log.recordCount(); i++) {
+ *              if(time.found) { use(time.raw(log.record(i))); }
+ *          }
+ *          closeTelemetryLog(log);
+ *      }
+*/
+
+#include "telemetryFormat.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/** A channel of one log, found by name. `found` is false if the log does not have it. */
+struct TelemetryLogChannel {
+    bool found = false;
+    uint16_t offset = 0;
+    uint8_t type = 0;
+    double divisor = 1;
+
+    /** @returns int64_t    The raw integer value in a record. */
+    int64_t raw(const uint8_t *record) const {
+        const uint8_t *value = record + offset;
+        switch(type) {
+            case telemetryInt8: return (int8_t)value[0];
+            case telemetryUint8: return value[0];
+            case telemetryInt16: { int16_t v; memcpy(&v, value, sizeof(v)); return v; }
+            case telemetryUint16: { uint16_t v; memcpy(&v, value, sizeof(v)); return v; }
+            case telemetryInt32: { int32_t v; memcpy(&v, value, sizeof(v)); return v; }
+            case telemetryUint32: { uint32_t v; memcpy(&v, value, sizeof(v)); return v; }
+            default: return 0;
+        }
+    }
+
+    /** @returns double     The value in the channel's units. */
+    double value(const uint8_t *record) const { return raw(record) / divisor; }
+};
+
+/** A memory mapped log. */
+struct TelemetryLog {
+    const char *path;
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    TelemetryFileHeader header;
+    const TelemetryChannel *channels = nullptr;
+
+    const uint8_t *records() const { return data + header.headerSize; }
+    size_t recordCount() const { return (size - header.headerSize) / header.recordSize; }
+    const uint8_t *record(size_t index) const { return records() + index * header.recordSize; }
+
+    TelemetryLogChannel channel(const char *name) const {
+        TelemetryLogChannel channel;
+        for(int i = 0; i < header.channelCount; i++) {
+            const TelemetryChannel &described = channels[i];
+            if(strncmp(described.name, name, sizeof(described.name)) != 0) { continue; }
+            int typeSize = telemetryTypeSize(described.type);
+            //Skip channels this reader does not understand, or that would read past the record
+            if(typeSize == 0 || described.offset + typeSize > header.recordSize) { break; }
+            channel.found = true;
+            channel.offset = described.offset;
+            channel.type = described.type;
+            channel.divisor = described.divisor ? described.divisor : 1;
+            break;
+        }
+        return channel;
+    }
+};
+
+/**
+ * Maps and checks a log.
+ * @returns bool   Whether the log can be read (if not, the reason was printed).
+*/
+inline bool openTelemetryLog(const char *path, TelemetryLog &log) {
+    log.path = path;
+    int file = open(path, O_RDONLY);
+    if(file < 0) {
+        fprintf(stderr, "can't open %s\n", path);
+        return false;
+    }
+    struct stat info;
+    if(fstat(file, &info) != 0 || info.st_size < (off_t)sizeof(TelemetryFileHeader)) {
+        fprintf(stderr, "%s is too short to be a log\n", path);
+        close(file);
+        return false;
+    }
+    log.size = (size_t)info.st_size;
+    void *data = mmap(nullptr, log.size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    if(data == MAP_FAILED) {
+        fprintf(stderr, "can't map %s\n", path);
+        return false;
+    }
+    madvise(data, log.size, MADV_SEQUENTIAL);
+    log.data = (const uint8_t *)data;
+
+    memcpy(&log.header, log.data, sizeof(log.header));
+    const TelemetryFileHeader &header = log.header;
+    if(memcmp(header.magic, TELEMETRY_MAGIC, sizeof(header.magic)) != 0) {
+        fprintf(stderr, "%s is not a telemetry log\n", path);
+    } else if(header.version > TELEMETRY_FORMAT_VERSION) {
+        fprintf(stderr, "%s is format version %u, this tool only reads up to %u\n",
+            path, header.version, TELEMETRY_FORMAT_VERSION);
+    } else if(header.recordSize == 0 || header.headerSize > log.size
+            || sizeof(header) + header.channelCount * sizeof(TelemetryChannel) > header.headerSize) {
+        fprintf(stderr, "%s has a broken header\n", path);
+    } else {
+        log.channels = (const TelemetryChannel *)(log.data + sizeof(header));
+        return true;
+    }
+    munmap(data, log.size);
+    return false;
+}
+
+inline void closeTelemetryLog(TelemetryLog &log) {
+    munmap((void *)log.data, log.size);
+}
+
+#endif
@@ -0,0 +1,268 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       telemetryStats.cpp                                              */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Telemetry Log Statistics Tool                                   */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+/**
+ * Usage: build-sim/telemetry-stats [--per-file] <telemNNN.bin>...
+ *
+ * Reads telemetry logs copied off the robot's SD card (see telemetry.h and
+ * telemetryFormat.h) and prints, over all of them:
+ *
+ *   - the records in each log, and how many were dropped on the robot
+ *   - the distribution of the time between ticks
+ *   - how well each wheel train's measured velocity tracks the velocity sent
+ *   - how many times each wheel train started slipping
+ *   - the average motor temperatures by minute since the program started
+ *   - the battery voltage
+ *
+ * With --per-file, one line is also printed for every log.
+ *
+ * Values are looked up by channel name in each log's header, so logs made
+ * with older or newer records can be mixed. Statistics whose channels are
+ * missing from a log just leave that log out. Files are memory mapped and only
+ * read once, front to back.
+*/
+
+#include "telemetryLog.h"
+
+#include <algorithm>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+/*----------------------------------- Statistics ----------------------------------*/
+
+/* Keeps every value so exact percentiles can be found (a season is only a few million ticks). */
+struct Distribution {
+    std::vector<double> values;
+    double sum = 0;
+    double sumSquares = 0;
+
+    void add(double value) {
+        values.push_back(value);
+        sum += value;
+        sumSquares += value * value;
+    }
+
+    size_t count() const { return values.size(); }
+    double mean() const { return values.empty() ? 0 : sum / values.size(); }
+    double rms() const { return values.empty() ? 0 : sqrt(sumSquares / values.size()); }
+
+    /* Sorts the values, so only call it once everything is added. */
+    double percentile(double percent) {
+        if(values.empty()) { return 0; }
+        size_t index = (size_t)ceil(percent / 100.0 * values.size());
+        index = index == 0 ? 0 : index - 1;
+        std::nth_element(values.begin(), values.begin() + index, values.end());
+        return values[index];
+    }
+
+    double max() const { return values.empty() ? 0 : *std::max_element(values.begin(), values.end()); }
+    double min() const { return values.empty() ? 0 : *std::min_element(values.begin(), values.end()); }
+};
+
+const int MAX_WHEELS = 8;
+
+/* An average of values that fall into each minute since the start of the logs. */
+struct Curve {
+    std::vector<double> sums;
+    std::vector<long> counts;
+
+    void add(size_t minute, double value) {
+        if(minute >= sums.size()) {
+            sums.resize(minute + 1, 0);
+            counts.resize(minute + 1, 0);
+        }
+        sums[minute] += value;
+        counts[minute]++;
+    }
+};
+
+struct Totals {
+    long logs = 0;
+    long records = 0;
+    long dropped = 0;
+    double seconds = 0;
+    Distribution tickPeriods;
+    Distribution trackingErrors[MAX_WHEELS];
+    long slips[MAX_WHEELS] = {};
+    Distribution battery;
+    Curve temperatures[MAX_WHEELS];
+};
+
+/* Adds one log to the totals. */
+static void readLog(const TelemetryLog &log, Totals &totals, bool perFile) {
+    size_t count = log.recordCount();
+    const uint8_t *records = log.records();
+    uint16_t recordSize = log.header.recordSize;
+
+    TelemetryLogChannel time = log.channel("time");
+    TelemetryLogChannel sequence = log.channel("sequence");
+    TelemetryLogChannel battery = log.channel("batteryVoltage");
+
+    char name[32];
+    TelemetryLogChannel velocity[MAX_WHEELS], measured[MAX_WHEELS], temperature[MAX_WHEELS], slipCount[MAX_WHEELS];
+    for(int wheel = 0; wheel < MAX_WHEELS; wheel++) {
+        snprintf(name, sizeof(name), "wheel%d.velocity", wheel);
+        velocity[wheel] = log.channel(name);
+        snprintf(name, sizeof(name), "wheel%d.measuredVelocity", wheel);
+        measured[wheel] = log.channel(name);
+        snprintf(name, sizeof(name), "wheel%d.temperature", wheel);
+        temperature[wheel] = log.channel(name);
+        snprintf(name, sizeof(name), "wheel%d.slips", wheel);
+        slipCount[wheel] = log.channel(name);
+    }
+
+    //Each log starts with the program, when no wheel has slipped yet
+    uint8_t lastSlips[MAX_WHEELS] = {};
+
+    long dropped = 0, slips = 0;
+    uint32_t firstTime = 0, lastTime = 0;
+    for(size_t i = 0; i < count; i++) {
+        const uint8_t *record = records + i * recordSize;
+
+        if(time.found) {
+            uint32_t now = (uint32_t)time.raw(record);
+            if(i == 0) {
+                firstTime = now;
+            } else {
+                //Ticks in between dropped records are not one tick long
+                bool gap = sequence.found && (uint16_t)(sequence.raw(record) - sequence.raw(record - recordSize)) != 1;
+                if(!gap) { totals.tickPeriods.add((uint32_t)(now - lastTime)); }
+            }
+            lastTime = now;
+
+            size_t minute = (size_t)((uint32_t)(now - firstTime) / 60000000u);
+            for(int wheel = 0; wheel < MAX_WHEELS; wheel++) {
+                if(temperature[wheel].found) { totals.temperatures[wheel].add(minute, temperature[wheel].value(record)); }
+            }
+        }
+
+        if(sequence.found && i > 0) {
+            dropped += (uint16_t)(sequence.raw(record) - sequence.raw(record - recordSize) - 1);
+        }
+
+        for(int wheel = 0; wheel < MAX_WHEELS; wheel++) {
+            if(velocity[wheel].found && measured[wheel].found) {
+                totals.trackingErrors[wheel].add(fabs(measured[wheel].value(record) - velocity[wheel].value(record)));
+            }
+        }
+
+        if(battery.found) { totals.battery.add(battery.value(record)); }
+
+        for(int wheel = 0; wheel < MAX_WHEELS; wheel++) {
+            if(!slipCount[wheel].found) { continue; }
+            //A count that wraps, so the difference still holds across dropped records
+            uint8_t now = (uint8_t)slipCount[wheel].raw(record);
+            uint8_t started = (uint8_t)(now - lastSlips[wheel]);
+            totals.slips[wheel] += started;
+            slips += started;
+            lastSlips[wheel] = now;
+        }
+    }
+
+    double seconds = count > 1 ? (uint32_t)(lastTime - firstTime) / 1000000.0 : 0;
+    totals.logs++;
+    totals.records += (long)count;
+    totals.dropped += dropped;
+    totals.seconds += seconds;
+
+    if(perFile) {
+        printf("%-24s v%u  %7zu records  %7.1f s  %5ld dropped  %4ld slips\n", log.path, log.header.version, count, seconds,
+            dropped, slips);
+    }
+}
+
+static void printTotals(Totals &totals) {
+    printf("logs              %ld (%.1f minutes)\n", totals.logs, totals.seconds / 60);
+    printf("records           %ld\n", totals.records);
+    printf("dropped           %ld (%.2f%%)\n", totals.dropped,
+        totals.records + totals.dropped ? 100.0 * totals.dropped / (totals.records + totals.dropped) : 0.0);
+
+    Distribution &periods = totals.tickPeriods;
+    if(periods.count() > 0) {
+        printf("tick period (us)  mean %.0f  min %.0f  p50 %.0f  p95 %.0f  p99 %.0f  max %.0f\n", periods.mean(),
+            periods.min(), periods.percentile(50), periods.percentile(95), periods.percentile(99), periods.max());
+    }
+
+    for(int wheel = 0; wheel < MAX_WHEELS; wheel++) {
+        Distribution &errors = totals.trackingErrors[wheel];
+        if(errors.count() == 0) { continue; }
+        printf("wheel%d tracking error (|measured - sent|, rpm)  mean %.2f  rms %.2f  p95 %.2f  max %.2f\n",
+            wheel, errors.mean(), errors.rms(), errors.percentile(95), errors.max());
+    }
+
+    for(int wheel = 0; wheel < MAX_WHEELS; wheel++) {
+        if(totals.slips[wheel] == 0) { continue; }
+        printf("wheel%d slips      %ld (%.2f per minute)\n", wheel, totals.slips[wheel],
+            totals.seconds > 0 ? totals.slips[wheel] / (totals.seconds / 60) : 0.0);
+    }
+
+    if(totals.battery.count() > 0) {
+        printf("battery (V)       mean %.2f  min %.2f  max %.2f\n",
+            totals.battery.mean(), totals.battery.min(), totals.battery.max());
+    }
+
+    bool anyTemperatures = false;
+    for(int wheel = 0; wheel < MAX_WHEELS; wheel++) { anyTemperatures |= !totals.temperatures[wheel].sums.empty(); }
+    if(anyTemperatures) {
+        printf("temperature (C, average by minute since the program started)\n");
+        printf("    minute");
+        for(int wheel = 0; wheel < MAX_WHEELS; wheel++) {
+            if(!totals.temperatures[wheel].sums.empty()) { printf("  wheel%d", wheel); }
+        }
+        printf("\n");
+        size_t minutes = 0;
+        for(int wheel = 0; wheel < MAX_WHEELS; wheel++) { minutes = std::max(minutes, totals.temperatures[wheel].sums.size()); }
+        for(size_t minute = 0; minute < minutes; minute++) {
+            printf("    %6zu", minute);
+            for(int wheel = 0; wheel < MAX_WHEELS; wheel++) {
+                const Curve &curve = totals.temperatures[wheel];
+                if(curve.sums.empty()) { continue; }
+                if(minute < curve.sums.size() && curve.counts[minute] > 0) {
+                    printf("  %6.1f", curve.sums[minute] / curve.counts[minute]);
+                } else {
+                    printf("  %6s", "-");
+                }
+            }
+            printf("\n");
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    bool perFile = false;
+    std::vector<const char *> paths;
+    for(int i = 1; i < argc; i++) {
+        if(strcmp(argv[i], "--per-file") == 0) {
+            perFile = true;
+        } else {
+            paths.push_back(argv[i]);
+        }
+    }
+    if(paths.empty()) {
+        fprintf(stderr, "usage: telemetry-stats [--per-file] <telemNNN.bin>...\n");
+        return 1;
+    }
+
+    Totals totals;
+    int unreadable = 0;
+    for(const char *path : paths) {
+        TelemetryLog log;
+        if(!openTelemetryLog(path, log)) {
+            unreadable++;
+            continue;
+        }
+        readLog(log, totals, perFile);
+        closeTelemetryLog(log);
+    }
+    if(perFile) { printf("\n"); }
+    printTotals(totals);
+    return unreadable == 0 ? 0 : 1;
+}
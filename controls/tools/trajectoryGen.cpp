@@ -0,0 +1,192 @@
+/*----------------------------------------------------------------------------------*/
+/*                                                                                  */
+/*    Module:       trajectoryGen.cpp                                               */
+/*    Author:       Firehawks Robotics                                              */
+/*    Created:      Sat Oct 17 2026                                                 */
+/*    Description:  Trajectory Table Generator                                      */
+/*                                                                                  */
+/*----------------------------------------------------------------------------------*/
+
+/**
+ * Usage: build-sim/trajectory-gen <trajectoryTables.h>
+ *
+ * Works out a trajectory for every route in ROUTES (see routes.h) and writes
+ * them as tables for the robot program (see trajectories.h), then prints how
+ * much flash each one takes. `make -f sim.mk` runs it whenever a header
+ * changes.
+ *
+ * Each trajectory:
+ *
+ *   - follows the spline through the route's waypoints (see splineAt())
+ *   - goes as fast as the route's speed allows, slowing down on curves so the
+ *     outside wheels stay under it
+ *   - speeds up and slows down at MOVE_BRAKING of the autonomous acceleration,
+ *     starting and ending stopped
+ *
+ * and is then sampled every TRAJECTORY_PERIOD. The left side's table is the
+ * right side's mirrored.
+ *
+ * Unlike the other tools this one is built with the simulator's headers,
+ * because it needs the robot's constants (the track width, the acceleration
+ * limits, ...).
+*/
+
+#include "vex.h"
+#include "trajectories.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <vector>
+
+/* How many points each stretch between two waypoints is cut into to plan the speed. */
+static const int PLAN_STEPS = 2000;
+
+/* One of the points the speed is planned at. */
+struct PlanPoint {
+    double x, y;
+    double distance;
+    /* Degrees clockwise from straight ahead (not wrapped), and how sharply the path bends clockwise (1/inch). */
+    double heading, curvature;
+    /* How fast the middle of the robot goes here (inches/s), and when it gets here (s). */
+    double velocity, time;
+};
+
+/* A sample of the trajectory, before it is rounded to fixed point. */
+struct Sample {
+    double x, y, heading;
+    double left, right;
+};
+
+static std::vector<PlanPoint> planRoute(const Route &route) {
+    std::vector<PlanPoint> points;
+    double topSpeed = route.speed * INCHES_PER_SECOND_PER_RPM;
+    for(int segment = 0; segment < route.count - 1; segment++) {
+        for(int step = segment == 0 ? 0 : 1; step <= PLAN_STEPS; step++) {
+            double t = (double)step / PLAN_STEPS;
+            Waypoint position = splineAt(route.waypoints, route.count, segment, t, 1);
+            Waypoint direction = splineAt(route.waypoints, route.count, segment, t, 1, 1);
+            Waypoint bend = splineAt(route.waypoints, route.count, segment, t, 1, 2);
+            double speed = hypot(direction.x, direction.y);
+
+            PlanPoint point;
+            point.x = position.x;
+            point.y = position.y;
+            point.heading = atan2(direction.x, direction.y) * 180.0 / M_PI;
+            point.curvature = speed == 0 ? 0 : (bend.x * direction.y - bend.y * direction.x) / (speed * speed * speed);
+            if(points.empty()) {
+                point.distance = 0;
+            } else {
+                const PlanPoint &last = points.back();
+                point.distance = last.distance + hypot(point.x - last.x, point.y - last.y);
+                //Keep the heading continuous, like odometry's
+                point.heading = last.heading + remainder(point.heading - last.heading, 360.0);
+            }
+            point.velocity = topSpeed / (1 + fabs(point.curvature) * TRACK_WIDTH / 2);
+            points.push_back(point);
+        }
+    }
+
+    //Start and end stopped, never speeding up or slowing down faster than the robot can
+    double acceleration = AUTONOMOUS_LIMITS.maxAcceleration * MOVE_BRAKING * INCHES_PER_SECOND_PER_RPM;
+    points.front().velocity = 0;
+    points.back().velocity = 0;
+    for(size_t i = 1; i < points.size(); i++) {
+        double reachable = sqrt(points[i - 1].velocity * points[i - 1].velocity
+            + 2 * acceleration * (points[i].distance - points[i - 1].distance));
+        points[i].velocity = fmin(points[i].velocity, reachable);
+    }
+    for(size_t i = points.size() - 1; i-- > 0;) {
+        double reachable = sqrt(points[i + 1].velocity * points[i + 1].velocity
+            + 2 * acceleration * (points[i + 1].distance - points[i].distance));
+        points[i].velocity = fmin(points[i].velocity, reachable);
+    }
+
+    points.front().time = 0;
+    for(size_t i = 1; i < points.size(); i++) {
+        double average = (points[i - 1].velocity + points[i].velocity) / 2;
+        points[i].time = points[i - 1].time + (average > 0 ? (points[i].distance - points[i - 1].distance) / average : 0);
+    }
+    return points;
+}
+
+static std::vector<Sample> sampleRoute(const std::vector<PlanPoint> &points) {
+    std::vector<Sample> samples;
+    size_t i = 0;
+    for(int k = 0; ; k++) {
+        double time = k * TRAJECTORY_PERIOD / 1000.0;
+        bool last = time >= points.back().time;
+        if(last) { time = points.back().time; }
+        while(i + 2 < points.size() && points[i + 1].time <= time) { i++; }
+
+        //Between plan point i and the next
+        const PlanPoint &a = points[i], &b = points[i + 1];
+        double f = b.time > a.time ? (time - a.time) / (b.time - a.time) : 1;
+        if(f > 1) { f = 1; }
+        double velocity = (a.velocity + f * (b.velocity - a.velocity)) / INCHES_PER_SECOND_PER_RPM;
+        double curvature = a.curvature + f * (b.curvature - a.curvature);
+        Sample sample;
+        sample.x = a.x + f * (b.x - a.x);
+        sample.y = a.y + f * (b.y - a.y);
+        sample.heading = a.heading + f * (b.heading - a.heading);
+        sample.left = velocity * (1 + curvature * TRACK_WIDTH / 2);
+        sample.right = velocity * (1 - curvature * TRACK_WIDTH / 2);
+        samples.push_back(sample);
+        if(last) { break; }
+    }
+    return samples;
+}
+
+static int16_t fixed(double value, int scale) {
+    double scaled = round(value * scale);
+    if(scaled > INT16_MAX || scaled < INT16_MIN) {
+        fprintf(stderr, "trajectory-gen: %f does not fit in a TrajectorySample\n", value);
+        exit(1);
+    }
+    return (int16_t)scaled;
+}
+
+/* One table. The left side's is the same trajectory mirrored: x and the heading flip, and the sides swap. */
+static void writeTable(FILE *out, const char *name, const char *side, const std::vector<Sample> &samples, int mirror) {
+    fprintf(out, "constexpr TrajectorySample %s_%s[%d] = {\n", name, side, (int)samples.size());
+    for(const Sample &sample : samples) {
+        fprintf(out, "    {%d, %d, %d, %d, %d},\n",
+            fixed(sample.x * mirror, TRAJECTORY_POSITION_SCALE), fixed(sample.y, TRAJECTORY_POSITION_SCALE),
+            fixed(sample.heading * mirror, TRAJECTORY_HEADING_SCALE),
+            fixed(mirror > 0 ? sample.left : sample.right, TRAJECTORY_VELOCITY_SCALE),
+            fixed(mirror > 0 ? sample.right : sample.left, TRAJECTORY_VELOCITY_SCALE));
+    }
+    fprintf(out, "};\n\n");
+}
+
+int main(int argc, char **argv) {
+    if(argc != 2) {
+        fprintf(stderr, "usage: trajectory-gen <trajectoryTables.h>\n");
+        return 1;
+    }
+    FILE *out = fopen(argv[1], "w");
+    if(out == nullptr) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fprintf(out, "/* Made by tools/trajectoryGen.cpp from routes.h (run `make -f sim.mk`), do not change by hand. See trajectories.h. */\n\n");
+    fprintf(out, "#ifndef TRAJECTORY_TABLES_HEADER_GUARD\n#define TRAJECTORY_TABLES_HEADER_GUARD\n\n");
+    fprintf(out, "#include \"trajectories.h\"\n\n");
+    for(int r = 0; r < NUM_ROUTES; r++) {
+        const Route &route = *ROUTES[r];
+        std::vector<PlanPoint> points = planRoute(route);
+        std::vector<Sample> samples = sampleRoute(points);
+        int bytes = (int)(samples.size() * sizeof(TrajectorySample));
+
+        fprintf(out, "/* %s: %.2f s, %.1f in, %d samples, %d bytes of flash. */\n",
+            route.name, points.back().time, points.back().distance, (int)samples.size(), bytes);
+        fprintf(out, "constexpr uint64_t %s_FINGERPRINT = %lluULL;\n\n", route.name, (unsigned long long)routeFingerprint(route));
+        writeTable(out, route.name, "RIGHT", samples, 1);
+        writeTable(out, route.name, "LEFT", samples, -1);
+
+        printf("trajectory %s: %.2f s, %.1f in, %d samples, %d bytes of flash (%d bytes per second)\n",
+            route.name, points.back().time, points.back().distance, (int)samples.size(), bytes, trajectoryBytesPerSecond());
+    }
+    fprintf(out, "#endif\n");
+    return fclose(out) == 0 ? 0 : 1;
+}